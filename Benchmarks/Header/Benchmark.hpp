@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+	Shared harness of the benchmark executables
+	Usage: <Bench> [positional arguments] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+	Every benchmark is warmed up, then timed once per repetition. The console
+	shows min, median & p99 of the repetitions, --json writes the same numbers
+	(in nanoseconds per run) so runs can be compared by scripts
+*/
+
+namespace Benchmark
+{
+	// Timings of one benchmark, nanoseconds per run
+	struct Result
+	{
+		std::string	m_name;
+		size_t		m_elements = 1;
+		int			m_repetitions = 0;
+		double		m_min = 0.0;
+		double		m_median = 0.0;
+		double		m_p99 = 0.0;
+		double		m_mean = 0.0;
+	};
+
+	// Cheap deterministic random so runs are comparable
+	class Random
+	{
+	public:
+		explicit Random(unsigned int seed) : m_state(seed) {}
+
+		float Float(float min, float max)
+		{
+			m_state = m_state * 1664525u + 1013904223u;
+
+			return min + (max - min) * (float) (m_state >> 8) / (float) (1u << 24);
+		}
+
+	private:
+		unsigned int m_state;
+	};
+
+	// Keep results alive so the optimizer can't drop the loops
+	inline void KeepAlive(double value)
+	{
+		static volatile double sink = 0.0;
+
+		sink = sink + value;
+	}
+
+	class Runner
+	{
+	public:
+		Runner(char const* suite, int argc, char** argv, int repetitions = 200)
+			: m_suite(suite), m_repetitions(repetitions)
+		{
+			for (int i = 1; i < argc; ++i)
+			{
+				char const* option = argv[i];
+				char const* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+				if (std::strncmp(option, "--", 2) != 0)
+				{
+					m_positional.push_back(option);
+					continue;
+				}
+
+				if (!value)
+				{
+					std::printf("%s: missing value after %s\n", m_suite.c_str(), option);
+					break;
+				}
+
+				if (std::strcmp(option, "--repetitions") == 0)
+					m_repetitions = std::max(1, std::atoi(value));
+				else if (std::strcmp(option, "--warmup") == 0)
+					m_warmup = std::max(0, std::atoi(value));
+				else if (std::strcmp(option, "--filter") == 0)
+					m_filter = value;
+				else if (std::strcmp(option, "--json") == 0)
+					m_jsonPath = value;
+				else
+					std::printf("%s: unknown option %s\n", m_suite.c_str(), option);
+
+				++i;
+			}
+		}
+
+		// Return positional argument index as a number, or the default value if missing
+		int Positional(size_t index, int defaultValue) const
+		{
+			return index < m_positional.size() ? std::atoi(m_positional[index]) : defaultValue;
+		}
+
+		int Repetitions(void) const { return m_repetitions; }
+
+		// Time func, elements is the work done per call for the per element column
+		// Return false if the name does not match the filter & nothing ran
+		// func is called through std::function so its body is compiled out of main, a main
+		// with every benchmark inlined grows past the inliner limits & stops inlining the code under test
+		bool Run(char const* name, size_t elements, std::function<void()> const& func)
+		{
+			if (!m_filter.empty() && !std::strstr(name, m_filter.c_str()))
+				return false;
+
+			using Clock = std::chrono::steady_clock;
+
+			for (int i = 0; i < m_warmup; ++i)
+				func();
+
+			std::vector<double> samples((size_t) m_repetitions);
+
+			for (double& sample : samples)
+			{
+				Clock::time_point start = Clock::now();
+
+				func();
+
+				sample = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			}
+
+			std::sort(samples.begin(), samples.end());
+
+			Result result;
+
+			result.m_name = name;
+			result.m_elements = std::max<size_t>(elements, 1);
+			result.m_repetitions = m_repetitions;
+			result.m_min = samples.front();
+			result.m_median = Percentile(samples, 0.5);
+			result.m_p99 = Percentile(samples, 0.99);
+
+			for (double sample : samples)
+				result.m_mean += sample / (double) samples.size();
+
+			std::printf("%-32s min %10.2f us  median %10.2f us  p99 %10.2f us  %9.3f ns/elem\n", name,
+						result.m_min / 1000.0, result.m_median / 1000.0, result.m_p99 / 1000.0, result.m_median / (double) result.m_elements);
+
+			m_results.push_back(result);
+
+			return true;
+		}
+
+		// Write the JSON report if one was asked for, return the process exit code
+		int Finish(void) const
+		{
+			if (m_jsonPath.empty())
+				return 0;
+
+			FILE* file = std::fopen(m_jsonPath.c_str(), "w");
+
+			if (!file)
+			{
+				std::printf("%s: could not open %s\n", m_suite.c_str(), m_jsonPath.c_str());
+				return 1;
+			}
+
+			std::fprintf(file, "{\n\t\"suite\": \"%s\",\n\t\"repetitions\": %d,\n\t\"warmup\": %d,\n\t\"results\":\n\t[\n",
+						 Escape(m_suite).c_str(), m_repetitions, m_warmup);
+
+			for (size_t i = 0; i < m_results.size(); ++i)
+			{
+				Result const& result = m_results[i];
+
+				std::fprintf(file, "\t\t{ \"name\": \"%s\", \"elements\": %zu, \"min_ns\": %.3f, \"median_ns\": %.3f, \"p99_ns\": %.3f, \"mean_ns\": %.3f }%s\n",
+							 Escape(result.m_name).c_str(), result.m_elements, result.m_min, result.m_median, result.m_p99, result.m_mean,
+							 i + 1 < m_results.size() ? "," : "");
+			}
+
+			std::fprintf(file, "\t]\n}\n");
+			std::fclose(file);
+
+			std::printf("results written to %s\n", m_jsonPath.c_str());
+
+			return 0;
+		}
+
+	private:
+		// Nearest rank percentile of sorted samples
+		static double Percentile(std::vector<double> const& sorted, double ratio)
+		{
+			size_t rank = (size_t) std::ceil(ratio * (double) sorted.size());
+
+			return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+		}
+
+		static std::string Escape(std::string const& text)
+		{
+			std::string escaped;
+
+			for (char character : text)
+			{
+				if (character == '"' || character == '\\')
+					escaped += '\\';
+
+				escaped += character;
+			}
+
+			return escaped;
+		}
+
+		std::string					m_suite;
+		std::string					m_filter;
+		std::string					m_jsonPath;
+		std::vector<char const*>	m_positional;
+		std::vector<Result>			m_results;
+		int							m_repetitions;
+		int							m_warmup = 3;
+	};
+}
@@ -0,0 +1,120 @@
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "LibMath/Batch.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+
+#include "Benchmark.hpp"
+
+// Micro benchmark of the LibMath batch kernels against the per element code they replace
+// Usage: BatchTransformBench [count] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	Benchmark::Random g_random(0x2468ace0u);
+
+	float RandomFloat(float min, float max)
+	{
+		return g_random.Float(min, max);
+	}
+
+	// Per element reference, Vector3 array of structures
+	void TransformPointsAoS(LibMath::Matrix4 const& matrix, std::vector<LibMath::Vector3> const& input, std::vector<LibMath::Vector3>& output)
+	{
+		const float (&m)[4][4] = matrix.m_matrix;
+
+		for (size_t i = 0; i < input.size(); ++i)
+		{
+			LibMath::Vector3 const& point = input[i];
+
+			output[i] = LibMath::Vector3
+			(
+				point.m_x * m[0][0] + point.m_y * m[1][0] + point.m_z * m[2][0] + m[3][0],
+				point.m_x * m[0][1] + point.m_y * m[1][1] + point.m_z * m[2][1] + m[3][1],
+				point.m_x * m[0][2] + point.m_y * m[1][2] + point.m_z * m[2][2] + m[3][2]
+			);
+		}
+	}
+
+	// Per element reference through a full 4x4 matrix product, as done by Mesh/Node code
+	void TransformPointsMatrix(LibMath::Matrix4 const& matrix, std::vector<LibMath::Vector3> const& input, std::vector<LibMath::Vector3>& output)
+	{
+		for (size_t i = 0; i < input.size(); ++i)
+		{
+			LibMath::Matrix4 point = LibMath::Matrix4::Translate(input[i]) * matrix;
+
+			output[i] = LibMath::Vector3(point.m_matrix[3][0], point.m_matrix[3][1], point.m_matrix[3][2]);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner	runner("BatchTransformBench", argc, argv);
+	size_t				count = (size_t) runner.Positional(0, 4096);
+
+	LibMath::Matrix4 matrix = LibMath::Matrix4::Transform(LibMath::Vector3(1.f, -2.f, 3.f),
+														  LibMath::Quaternion(LibMath::Radian(0.7f), LibMath::Vector3(1.f, 2.f, -1.f)),
+														  LibMath::Vector3(1.5f, 0.5f, 2.f));
+
+	// Same data in both layouts
+	std::vector<LibMath::Vector3>	pointsAoS(count), resultAoS(count), extentsAoS(count), resultExtentsAoS(count);
+	std::vector<float>				x(count), y(count), z(count), outX(count), outY(count), outZ(count);
+	std::vector<float>				ex(count), ey(count), ez(count), outEx(count), outEy(count), outEz(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		pointsAoS[i] = LibMath::Vector3(RandomFloat(-50.f, 50.f), RandomFloat(-50.f, 50.f), RandomFloat(-50.f, 50.f));
+		extentsAoS[i] = LibMath::Vector3(RandomFloat(0.1f, 3.f), RandomFloat(0.1f, 3.f), RandomFloat(0.1f, 3.f));
+
+		x[i] = pointsAoS[i].m_x;
+		y[i] = pointsAoS[i].m_y;
+		z[i] = pointsAoS[i].m_z;
+
+		ex[i] = extentsAoS[i].m_x;
+		ey[i] = extentsAoS[i].m_y;
+		ez[i] = extentsAoS[i].m_z;
+	}
+
+	LibMath::Vector3Span	points = { x, y, z };
+	LibMath::Vector3Span	extents = { ex, ey, ez };
+	LibMath::Vector3Span	outPoints = { outX, outY, outZ };
+	LibMath::Vector3Span	outExtents = { outEx, outEy, outEz };
+
+	std::printf("BatchTransformBench: %zu elements, %d repetitions\n", count, runner.Repetitions());
+
+	// Check the batch kernels against the per element versions, outside of the timed runs
+	for (size_t i = 0; i < count; ++i)
+		LibMath::transformAABB(matrix, pointsAoS[i], extentsAoS[i], resultAoS[i], resultExtentsAoS[i]);
+
+	LibMath::transformAABBs(matrix, points, extents, outPoints, outExtents);
+
+	float maxError = 0.f;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		maxError = std::fmax(maxError, std::fabs(outX[i] - resultAoS[i].m_x) + std::fabs(outY[i] - resultAoS[i].m_y) + std::fabs(outZ[i] - resultAoS[i].m_z));
+		maxError = std::fmax(maxError, std::fabs(outEx[i] - resultExtentsAoS[i].m_x) + std::fabs(outEy[i] - resultExtentsAoS[i].m_y) + std::fabs(outEz[i] - resultExtentsAoS[i].m_z));
+	}
+
+	std::printf("max difference with per element results: %g\n\n", maxError);
+
+	runner.Run("points (matrix product)", count, [&] { TransformPointsMatrix(matrix, pointsAoS, resultAoS); Benchmark::KeepAlive(resultAoS[0].m_x); });
+	runner.Run("points (AoS loop)", count, [&] { TransformPointsAoS(matrix, pointsAoS, resultAoS); Benchmark::KeepAlive(resultAoS[0].m_x); });
+	runner.Run("points (SoA batch)", count, [&] { LibMath::transformPoints(matrix, points, outPoints); Benchmark::KeepAlive(outX[0]); });
+	runner.Run("directions (SoA batch)", count, [&] { LibMath::transformDirections(matrix, points, outPoints); Benchmark::KeepAlive(outX[0]); });
+
+	runner.Run("AABBs (per box)", count, [&]
+	{
+		for (size_t i = 0; i < count; ++i)
+			LibMath::transformAABB(matrix, pointsAoS[i], extentsAoS[i], resultAoS[i], resultExtentsAoS[i]);
+
+		Benchmark::KeepAlive(resultExtentsAoS[0].m_x);
+	});
+
+	runner.Run("AABBs (SoA batch)", count, [&] { LibMath::transformAABBs(matrix, points, extents, outPoints, outExtents); Benchmark::KeepAlive(outEx[0]); });
+
+	return runner.Finish();
+}
@@ -0,0 +1,430 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "LibMath/Vector/Vector3.h"
+
+#include "Graph.hpp"
+
+#include "PhysicsLib/ColliderHierarchy.hpp"
+#include "PhysicsLib/DynamicAABBTree.h"
+#include "PhysicsLib/Frustum.h"
+#include "PhysicsLib/FrustumCuller.h"
+#include "PhysicsLib/RayCast.h"
+#include "PhysicsLib/SpatialHashGrid.h"
+
+#include "Benchmark.hpp"
+
+// Broad phase queries through the dynamic AABB tree & the hashed grid against testing every collider
+// Usage: BroadphaseBench [count] [cell size] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	Benchmark::Random g_random(0x2468ace0u);
+
+	LibMath::Vector3 RandomVector(float min, float max)
+	{
+		return LibMath::Vector3(g_random.Float(min, max), g_random.Float(min, max), g_random.Float(min, max));
+	}
+
+	// Level style box, spread over the floor & a few meters high
+	LibMath::Vector3 RandomPosition(void)
+	{
+		return LibMath::Vector3(g_random.Float(-100.f, 100.f), g_random.Float(0.f, 10.f), g_random.Float(-100.f, 100.f));
+	}
+
+	// Scene node holding nothing, colliders only read its global transform
+	class MeshNode : public Node
+	{
+	public:
+		MeshNode(MeshNode* parent, int* object)
+			: Node(parent), m_object(object)
+		{}
+
+		~MeshNode(void)
+		{
+			delete m_object;
+		}
+
+		int*	m_object;
+	};
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner	runner("BroadphaseBench", argc, argv);
+	size_t				count = (size_t) runner.Positional(0, 4096);
+	float				cellSize = (float) runner.Positional(1, 8);
+
+	// Colliders grouped under four quadrant areas, like the hand placed level areas
+	BVHierarchy						colliders;
+	std::vector<BVHierarchy::BVNode*>	leaves;
+
+	colliders.AddCollider<BoxBV>("world", LibMath::Vector3::zero(), LibMath::Vector3(200.f, 200.f, 200.f));
+
+	const char* areas[4] = { "area1", "area2", "area3", "area4" };
+
+	for (int area = 0; area < 4; ++area)
+	{
+		const float x = area % 2 ? -50.f : 50.f, z = area / 2 ? -50.f : 50.f;
+
+		colliders.AddCollider<BoxBV>(std::string("world"), std::string(areas[area]), LibMath::Vector3(x, 5.f, z), LibMath::Vector3(50.f, 5.f, 50.f));
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const LibMath::Vector3	position = RandomPosition();
+		const int				area = (position.m_x < 0.f ? 1 : 0) + (position.m_z < 0.f ? 2 : 0);
+		const std::string		key = "box" + std::to_string(i);
+
+		colliders.AddCollider<BoxBV>(std::string(areas[area]), key, position, RandomVector(0.25f, 3.f));
+		leaves.push_back(colliders.m_hierarchy.GetNode(Key(key)));
+	}
+
+	// Incrementally inserted tree, then the SAH build the level uses
+	const int32_t	incrementalHeight = colliders.m_tree.GetHeight();
+
+	colliders.BuildBroadphase();
+
+	std::printf("BroadphaseBench: %zu colliders, tree height %d (incremental %d), %d repetitions\n",
+				count, colliders.m_tree.GetHeight(), incrementalHeight, runner.Repetitions());
+
+	// Player sized probes & rays through the level
+	const size_t					probeCount = 256;
+	std::vector<SphereBV>			probes;
+	std::vector<Ray>				rays;
+
+	for (size_t i = 0; i < probeCount; ++i)
+	{
+		probes.emplace_back(0.75f, RandomPosition());
+		rays.emplace_back(RandomPosition(), RandomVector(-1.f, 1.f));
+	}
+
+	std::vector<BVHierarchy::BVNode*>	candidates;
+	size_t								mismatches = 0;
+
+	// Every collider tested, the reference
+	auto probeAll = [&]
+	{
+		size_t hits = 0;
+
+		for (SphereBV& probe : probes)
+		{
+			for (BVHierarchy::BVNode* leaf : leaves)
+				hits += leaf->TestCollision(&probe);
+		}
+
+		return hits;
+	};
+
+	auto probeTree = [&]
+	{
+		size_t hits = 0;
+
+		for (SphereBV& probe : probes)
+		{
+			colliders.QueryColliders(&probe, candidates);
+
+			for (BVHierarchy::BVNode* leaf : candidates)
+				hits += leaf->TestCollision(&probe);
+		}
+
+		return hits;
+	};
+
+	auto rayAll = [&]
+	{
+		size_t	hits = 0;
+		float	distance;
+
+		for (const Ray& ray : rays)
+		{
+			for (BVHierarchy::BVNode* leaf : leaves)
+				hits += ray.Intersect(*static_cast<BoxBV*>(leaf->m_collider), distance);
+		}
+
+		return hits;
+	};
+
+	auto rayTree = [&]
+	{
+		size_t	hits = 0;
+		float	distance;
+
+		for (const Ray& ray : rays)
+		{
+			colliders.QueryColliders(ray, candidates);
+
+			for (BVHierarchy::BVNode* leaf : candidates)
+				hits += ray.Intersect(*static_cast<BoxBV*>(leaf->m_collider), distance);
+		}
+
+		return hits;
+	};
+
+	if (probeAll() != probeTree())
+	{
+		std::printf("probe: %zu hits instead of %zu\n", probeTree(), probeAll());
+		++mismatches;
+	}
+
+	if (rayAll() != rayTree())
+	{
+		std::printf("ray: %zu hits instead of %zu\n", rayTree(), rayAll());
+		++mismatches;
+	}
+
+	runner.Run("probe (every collider)", probeCount, [&] { Benchmark::KeepAlive((double) probeAll()); });
+	runner.Run("probe (tree)", probeCount, [&] { Benchmark::KeepAlive((double) probeTree()); });
+	runner.Run("ray (every collider)", probeCount, [&] { Benchmark::KeepAlive((double) rayAll()); });
+	runner.Run("ray (tree)", probeCount, [&] { Benchmark::KeepAlive((double) rayTree()); });
+
+	// Same queries once the colliders are moved to the grid
+	colliders.m_grid.SetCellSize(cellSize);
+	colliders.SetBroadphase(BroadphaseType::GRID);
+
+	if (probeAll() != probeTree())
+	{
+		std::printf("grid probe: %zu hits instead of %zu\n", probeTree(), probeAll());
+		++mismatches;
+	}
+
+	if (rayAll() != rayTree())
+	{
+		std::printf("grid ray: %zu hits instead of %zu\n", rayTree(), rayAll());
+		++mismatches;
+	}
+
+	runner.Run("probe (grid)", probeCount, [&] { Benchmark::KeepAlive((double) probeTree()); });
+	runner.Run("ray (grid)", probeCount, [&] { Benchmark::KeepAlive((double) rayTree()); });
+
+	// And to sweep & prune, queries scan the sorted x endpoints
+	colliders.SetBroadphase(BroadphaseType::SWEEP_AND_PRUNE);
+
+	if (probeAll() != probeTree())
+	{
+		std::printf("sweep & prune probe: %zu hits instead of %zu\n", probeTree(), probeAll());
+		++mismatches;
+	}
+
+	runner.Run("probe (sweep & prune)", probeCount, [&] { Benchmark::KeepAlive((double) probeTree()); });
+
+	// Tree maintenance on raw boxes
+	std::vector<LibMath::Vector3>	mins(count), maxs(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const BoxBV* box = static_cast<BoxBV*>(leaves[i]->m_collider);
+
+		mins[i] = box->m_minVertex;
+		maxs[i] = box->m_maxVertex;
+	}
+
+	PhysicsLib::DynamicAABBTree	tree;
+	std::vector<int32_t>		proxies(count);
+
+	auto insertAll = [&]
+	{
+		tree.Clear();
+
+		for (size_t i = 0; i < count; ++i)
+			proxies[i] = tree.CreateProxy(mins[i], maxs[i], nullptr);
+	};
+
+	PhysicsLib::SpatialHashGrid	grid(cellSize);
+
+	auto insertAllGrid = [&]
+	{
+		grid.Clear();
+
+		for (size_t i = 0; i < count; ++i)
+			proxies[i] = grid.CreateProxy(mins[i], maxs[i], nullptr);
+	};
+
+	runner.Run("insert (tree, incremental)", count, [&] { insertAll(); Benchmark::KeepAlive((double) tree.GetHeight()); });
+	runner.Run("build (tree, binned SAH)", count, [&] { tree.Build(); Benchmark::KeepAlive((double) tree.GetHeight()); });
+	runner.Run("insert (grid)", count, [&] { insertAllGrid(); Benchmark::KeepAlive((double) grid.GetProxyCount()); });
+
+	// A tenth of the boxes move each frame, most stay inside their fat box or their cells
+	const size_t		movingCount = count / 10;
+	float				time = 0.f;
+
+	auto moveAll = [&](auto& structure)
+	{
+		time += 0.1f;
+
+		const LibMath::Vector3	offset(std::sin(time), 0.f, std::cos(time));
+		size_t					moved = 0;
+
+		for (size_t i = 0; i < movingCount; ++i)
+			moved += structure.MoveProxy(proxies[i], mins[i] + offset, maxs[i] + offset);
+
+		return moved;
+	};
+
+	runner.Run("move 10% (grid)", movingCount, [&] { Benchmark::KeepAlive((double) moveAll(grid)); });
+
+	insertAll();
+
+	runner.Run("move 10% (tree)", movingCount, [&] { Benchmark::KeepAlive((double) moveAll(tree)); });
+
+	// Overlapping pairs of the moving boxes: queried again every frame against kept up to date by the moves
+	auto pairsTree = [&]
+	{
+		moveAll(tree);
+
+		size_t pairs = 0;
+
+		for (size_t i = 0; i < movingCount; ++i)
+			tree.Query(tree.GetFatMin(proxies[i]), tree.GetFatMax(proxies[i]), [&](int32_t) { ++pairs; return true; });
+
+		return pairs;
+	};
+
+	runner.Run("move 10% + pairs (tree queries)", movingCount, [&] { Benchmark::KeepAlive((double) pairsTree()); });
+
+	PhysicsLib::SweepAndPrune	sweep;
+
+	for (size_t i = 0; i < count; ++i)
+		proxies[i] = sweep.CreateProxy(mins[i], maxs[i], nullptr);
+
+	sweep.Build();
+
+	runner.Run("move 10% + pairs (sweep & prune)", movingCount, [&] { moveAll(sweep); Benchmark::KeepAlive((double) sweep.GetPairCount()); });
+
+	std::printf("mismatches with every collider results: %zu\n", mismatches);
+
+	// Per frame collider update, every collider linked to a mesh & a tenth of them moving
+	Graph<MeshNode>		scene;
+	BVHierarchy			level;
+	std::vector<Node*>	movingMeshes;
+
+	level.AddStaticCollider<BoxBV>("world", LibMath::Vector3::zero(), LibMath::Vector3(200.f, 200.f, 200.f));
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const std::string	key = "mesh" + std::to_string(i);
+		const bool			moving = i < movingCount;
+
+		scene.AddChild<int>(key);
+
+		Node* mesh = scene.GetNode(Key(key));
+
+		mesh->m_translation = RandomPosition();
+		mesh->m_scale = RandomVector(0.25f, 3.f);
+		mesh->MarkDirty();
+
+		if (moving)
+		{
+			level.AddCollider<BoxBV>(std::string("world"), key);
+			movingMeshes.push_back(mesh);
+		}
+		else
+			level.AddStaticCollider<BoxBV>(std::string("world"), key);
+
+		level.LinkToNode(scene, key, key);
+	}
+
+	scene.UpdateGraph();
+	level.BuildBroadphase();
+
+	// View looking down -z from the origin, about half the level inside
+	Frustum view;
+
+	view[NEAR] = Plane(LibMath::Vector3(0.f, 0.f, -1.f), 0.f);
+	view[FAR] = Plane(LibMath::Vector3(0.f, 0.f, 1.f), -100.f);
+	view[LEFT] = Plane(LibMath::Vector3(0.707f, 0.f, -0.707f), 0.f);
+	view[RIGHT] = Plane(LibMath::Vector3(-0.707f, 0.f, -0.707f), 0.f);
+	view[TOP] = Plane(LibMath::Vector3(0.f, -1.f, 0.f), -20.f);
+	view[BOTTOM] = Plane(LibMath::Vector3(0.f, 1.f, 0.f), -20.f);
+
+	auto moveMeshes = [&]
+	{
+		time += 0.1f;
+
+		const LibMath::Vector3 offset(0.1f * std::sin(time), 0.f, 0.1f * std::cos(time));
+
+		for (Node* mesh : movingMeshes)
+		{
+			mesh->m_translation += offset;
+			mesh->MarkDirty();
+		}
+
+		scene.UpdateGraph();
+	};
+
+	auto countRendered = [&]
+	{
+		size_t rendered = 0;
+
+		for (MeshNode* mesh : scene.PreOrder())
+			rendered += mesh->m_render;
+
+		return rendered;
+	};
+
+	// Walk every collider like before the static/dynamic split
+	auto updateAll = [&]
+	{
+		for (BVHierarchy::BVNode* node : level.m_hierarchy.PreOrder())
+			node->Update(view);
+	};
+
+	// Both go through one update first, culling reads the boxes of the previous frame
+	// Static culling is a little more conservative, it may draw more meshes but never fewer
+	std::vector<char> renderedAll;
+
+	updateAll();
+	updateAll();
+
+	for (MeshNode* mesh : scene.PreOrder())
+		renderedAll.push_back(mesh->m_render);
+
+	level.Update(view);
+
+	size_t hidden = 0, index = 0;
+
+	for (MeshNode* mesh : scene.PreOrder())
+		hidden += renderedAll[index++] && !mesh->m_render;
+
+	std::printf("update: %zu meshes rendered, %zu with every collider\n", countRendered(), std::count(renderedAll.begin(), renderedAll.end(), 1));
+
+	if (hidden)
+	{
+		std::printf("update: %zu meshes culled that every collider draws\n", hidden);
+		++mismatches;
+	}
+
+	runner.Run("update (every collider)", count, [&] { moveMeshes(); updateAll(); Benchmark::KeepAlive((double) movingMeshes.size()); });
+	runner.Run("update (dynamic, static cull)", count, [&] { moveMeshes(); level.Update(view); Benchmark::KeepAlive((double) movingMeshes.size()); });
+
+	// Culling alone, the static boxes one at a time against batched
+	std::vector<BoxBV>				staticBoxes;
+	PhysicsLib::FrustumCuller		culler;
+
+	for (BVHierarchy::BVNode* node : level.m_hierarchy.PreOrder())
+	{
+		if (node->m_static && node->m_sceneNode.Get())
+			staticBoxes.push_back(*static_cast<BoxBV*>(node->m_collider));
+	}
+
+	for (const BoxBV& box : staticBoxes)
+		culler.Add(box.m_position, box.m_boxScale);
+
+	runner.Run("cull (Frustum::Intersect)", staticBoxes.size(), [&]
+	{
+		size_t visible = 0;
+
+		for (const BoxBV& box : staticBoxes)
+			visible += view.Intersect(box);
+
+		Benchmark::KeepAlive((double) visible);
+	});
+
+	runner.Run("cull (FrustumCuller)", staticBoxes.size(), [&] { Benchmark::KeepAlive((double) culler.Cull(view)); });
+
+	return mismatches ? 1 : runner.Finish();
+}
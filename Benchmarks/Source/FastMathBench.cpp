@@ -0,0 +1,169 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "LibMath/Arithmetic.h"
+#include "LibMath/FastMath.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include "Benchmark.hpp"
+
+// Error & throughput of the LibMath::Fast functions against the std ones
+// Usage: FastMathBench [samples] [--repetitions N] [--warmup N] [--filter text] [--json file]
+// The error table in FastMath.h comes from this program
+
+namespace
+{
+	Benchmark::Random g_random(0x0badf00du);
+
+	float RandomFloat(float min, float max)
+	{
+		return g_random.Float(min, max);
+	}
+
+	// Distance in units in the last place of the float closest to the reference
+	double UlpError(float value, double reference)
+	{
+		const float	rounded = (float) reference;
+		const float	ulp = std::nextafter(std::fabs(rounded), INFINITY) - std::fabs(rounded);
+
+		return std::fabs((double) value - reference) / (double) ulp;
+	}
+
+	struct Error
+	{
+		double m_ulp = 0.0;
+		double m_absolute = 0.0;
+
+		void Add(float value, double reference)
+		{
+			m_ulp = std::fmax(m_ulp, UlpError(value, reference));
+			m_absolute = std::fmax(m_absolute, std::fabs((double) value - reference));
+		}
+	};
+
+	template <typename TFast, typename TReference>
+	void Report(char const* name, float min, float max, size_t samples, TFast&& fast, TReference&& reference, bool logarithmic = false)
+	{
+		Error error;
+
+		for (size_t i = 0; i < samples; ++i)
+		{
+			float x = logarithmic ? std::exp2(RandomFloat(std::log2(min), std::log2(max))) : RandomFloat(min, max);
+
+			error.Add(fast(x), reference((double) x));
+		}
+
+		std::printf("%-18s [%g, %g] %10.2f ULP %12.3g absolute\n", name, min, max, error.m_ulp, error.m_absolute);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner	runner("FastMathBench", argc, argv, 100);
+	size_t				samples = (size_t) runner.Positional(0, 1000000);
+
+	std::printf("FastMathBench: %zu samples per range\n\n", samples);
+
+	const float pi = 3.14159265359f;
+
+	// Max error tables
+	Report("sin", -pi, pi, samples, [](float x) { return LibMath::Fast::sin(x); }, [](double x) { return std::sin(x); });
+	Report("cos", -pi, pi, samples, [](float x) { return LibMath::Fast::cos(x); }, [](double x) { return std::cos(x); });
+	Report("sin", -8192.f, 8192.f, samples, [](float x) { return LibMath::Fast::sin(x); }, [](double x) { return std::sin(x); });
+	Report("cos", -8192.f, 8192.f, samples, [](float x) { return LibMath::Fast::cos(x); }, [](double x) { return std::cos(x); });
+	Report("tan", -1.5f, 1.5f, samples, [](float x) { return LibMath::Fast::tan(x); }, [](double x) { return std::tan(x); });
+	Report("atan", -1e4f, 1e4f, samples, [](float x) { return LibMath::Fast::atan(x); }, [](double x) { return std::atan(x); });
+	Report("atan", -4.f, 4.f, samples, [](float x) { return LibMath::Fast::atan(x); }, [](double x) { return std::atan(x); });
+	Report("inverseSquareRoot", 1e-30f, 1e30f, samples, [](float x) { return LibMath::Fast::inverseSquareRoot(x); },
+		   [](double x) { return 1.0 / std::sqrt(x); }, true);
+
+	// Normalize, worst component
+	{
+		Error error;
+
+		for (size_t i = 0; i < samples; ++i)
+		{
+			float				scale = std::exp2(RandomFloat(-50.f, 50.f));
+			LibMath::Vector3	vector(RandomFloat(-1.f, 1.f) * scale, RandomFloat(-1.f, 1.f) * scale, RandomFloat(-1.f, 1.f) * scale);
+			LibMath::Vector3	fast = LibMath::Fast::normalizedCopy(vector);
+
+			double x = vector.m_x, y = vector.m_y, z = vector.m_z;
+			double length = std::sqrt(x * x + y * y + z * z);
+
+			error.Add(fast.m_x, x / length);
+			error.Add(fast.m_y, y / length);
+			error.Add(fast.m_z, z / length);
+		}
+
+		std::printf("%-18s [1e-15, 1e15] %6.2f ULP %12.3g absolute\n", "normalizedCopy", error.m_ulp, error.m_absolute);
+	}
+
+	// Throughput, same inputs for both versions
+	std::vector<float>				angles(4096), positives(4096);
+	std::vector<LibMath::Vector3>	vectors(4096);
+
+	for (size_t i = 0; i < angles.size(); ++i)
+	{
+		angles[i] = RandomFloat(-pi, pi);
+		positives[i] = RandomFloat(0.01f, 100.f);
+		vectors[i] = LibMath::Vector3(RandomFloat(-5.f, 5.f), RandomFloat(-5.f, 5.f), RandomFloat(-5.f, 5.f));
+	}
+
+	std::printf("\n");
+
+	auto sum = [&](auto&& func, std::vector<float> const& inputs)
+	{
+		return [&, func]
+		{
+			float total = 0.f;
+
+			for (float input : inputs)
+				total += func(input);
+
+			Benchmark::KeepAlive(total);
+		};
+	};
+
+	runner.Run("sinf", angles.size(), sum([](float x) { return sinf(x); }, angles));
+	runner.Run("Fast::sin", angles.size(), sum([](float x) { return LibMath::Fast::sin(x); }, angles));
+	runner.Run("sinf + cosf", angles.size(), sum([](float x) { return sinf(x) + cosf(x); }, angles));
+	runner.Run("Fast::sinCos", angles.size(), sum([](float x) { float s, c; LibMath::Fast::sinCos(x, s, c); return s + c; }, angles));
+	runner.Run("tanf", angles.size(), sum([](float x) { return tanf(x * 0.45f); }, angles));
+	runner.Run("Fast::tan", angles.size(), sum([](float x) { return LibMath::Fast::tan(x * 0.45f); }, angles));
+	runner.Run("atanf", positives.size(), sum([](float x) { return atanf(x); }, positives));
+	runner.Run("Fast::atan", positives.size(), sum([](float x) { return LibMath::Fast::atan(x); }, positives));
+	runner.Run("1 / squareRoot", positives.size(), sum([](float x) { return 1.f / LibMath::squareRoot(x); }, positives));
+	runner.Run("Fast::inverseSquareRoot", positives.size(), sum([](float x) { return LibMath::Fast::inverseSquareRoot(x); }, positives));
+
+	runner.Run("Vector3::normalizedCopy", vectors.size(), [&]
+	{
+		float total = 0.f;
+
+		for (LibMath::Vector3 const& vector : vectors)
+		{
+			LibMath::Vector3 normalized = vector.normalizedCopy();
+
+			total += normalized.m_x + normalized.m_y + normalized.m_z;
+		}
+
+		Benchmark::KeepAlive(total);
+	});
+
+	runner.Run("Fast::normalizedCopy", vectors.size(), [&]
+	{
+		float total = 0.f;
+
+		for (LibMath::Vector3 const& vector : vectors)
+		{
+			LibMath::Vector3 normalized = LibMath::Fast::normalizedCopy(vector);
+
+			total += normalized.m_x + normalized.m_y + normalized.m_z;
+		}
+
+		Benchmark::KeepAlive(total);
+	});
+
+	return runner.Finish();
+}
@@ -0,0 +1,222 @@
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include "PhysicsLib/CollisionDetection.h"
+#include "PhysicsLib/ColliderHierarchy.hpp"
+
+#include "Node.h"
+#include "TransformHierarchy.h"
+
+#include "Benchmark.hpp"
+
+// Benchmark of the per-frame hot loops: collider pair tests & scene graph transform update
+// Usage: HotLoopBench [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	Benchmark::Random g_random(0x12345678u);
+
+	float RandomFloat(float min, float max)
+	{
+		return g_random.Float(min, max);
+	}
+
+	LibMath::Vector3 RandomVector(float min, float max)
+	{
+		return LibMath::Vector3(RandomFloat(min, max), RandomFloat(min, max), RandomFloat(min, max));
+	}
+
+	// Player-style loop, one moving box & sphere against every level collider
+	void CollisionLoop(std::vector<PhysicsLib::BoxCollider> const& boxes, std::vector<PhysicsLib::SphereCollider> const& spheres)
+	{
+		int hits = 0;
+
+		for (int frame = 0; frame < 64; ++frame)
+		{
+			LibMath::Vector3 position(frame * 0.25f, 0.0f, frame * -0.125f);
+
+			PhysicsLib::BoxCollider		player(position, LibMath::Vector3(0.5f, 1.0f, 0.5f));
+			PhysicsLib::SphereCollider	probe(0.75f, position);
+
+			for (PhysicsLib::BoxCollider const& box : boxes)
+			{
+				hits += player.CheckCollision(box);
+				hits += probe.CheckCollision(box);
+			}
+
+			for (PhysicsLib::SphereCollider const& sphere : spheres)
+				hits += probe.CheckCollision(sphere);
+		}
+
+		Benchmark::KeepAlive(hits);
+	}
+
+	// All pairs between level boxes, the worst case for a brute force broad phase
+	void BoxPairLoop(std::vector<PhysicsLib::BoxCollider> const& boxes)
+	{
+		int hits = 0;
+
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			for (size_t j = i + 1; j < boxes.size(); ++j)
+				hits += PhysicsLib::BoxCollider::CheckCollision(boxes[i], boxes[j]);
+		}
+
+		Benchmark::KeepAlive(hits);
+	}
+
+	// Scene graph, levels deep with 8 children per node, nodes are in depth order
+	// Node destructor is not safe to run on a heap built tree, the process reclaims it on exit
+	Node* BuildTree(std::vector<Node*>& nodes, int levels)
+	{
+		Node*				root = new Node();
+		std::vector<Node*>	parents = { root };
+
+		for (int depth = 0; depth < levels; ++depth)
+		{
+			std::vector<Node*> nextParents;
+
+			for (Node* parent : parents)
+			{
+				for (int i = 0; i < 8; ++i)
+				{
+					Node* child = new Node(parent);
+
+					child->m_translation = RandomVector(-5.0f, 5.0f);
+					child->m_rotation = LibMath::Quaternion(LibMath::Radian(RandomFloat(0.0f, 6.28f)), LibMath::Vector3::up());
+
+					parent->m_children.push_back(child);
+					nodes.push_back(child);
+					nextParents.push_back(child);
+				}
+			}
+
+			parents = nextParents;
+		}
+
+		return root;
+	}
+
+	// Dirty moved nodes (every step-th one) & recompute their global transforms
+	template <typename TUpdate>
+	size_t TransformLoop(std::vector<Node*> const& nodes, size_t step, TUpdate&& update)
+	{
+		for (size_t i = 0; i < nodes.size(); i += step)
+		{
+			nodes[i]->m_translation.m_x += 0.01f;
+			nodes[i]->MarkDirty();
+		}
+
+		const size_t updated = update();
+
+		Benchmark::KeepAlive(nodes.back()->GetGlobalTransform().m_matrix[3][0]);
+
+		return updated;
+	}
+
+	// Level load & reset, every collider & its node allocated then destroyed
+	void ColliderBuildLoop(std::vector<PhysicsLib::BoxCollider> const& boxes)
+	{
+		BVHierarchy colliders;
+
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			const std::string key = "box " + std::to_string(i);
+
+			colliders.AddCollider<BoxBV>(key, boxes[i].m_position, boxes[i].m_boxScale);
+		}
+
+		Benchmark::KeepAlive((double) colliders.m_hierarchy.m_worldRoot->m_children.size());
+	}
+
+	// Collider transforms rebuilt from matrices, as done when moving blocks
+	void ColliderUpdateLoop(std::vector<PhysicsLib::BoxCollider>& boxes, std::vector<Node*> const& nodes)
+	{
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			LibMath::Matrix4 const& global = nodes[i % nodes.size()]->GetGlobalTransform();
+
+			LibMath::Vector3 position(global.m_matrix[3][0], global.m_matrix[3][1], global.m_matrix[3][2]);
+
+			boxes[i].SetColliderTransform(position, boxes[i].m_boxScale);
+		}
+
+		Benchmark::KeepAlive(boxes.back().m_minVertex.m_x);
+	}
+
+	// Same tree twice, updated recursively & through the flat storage
+	void TransformLoops(Benchmark::Runner& runner, int levels, std::string const& suffix)
+	{
+		std::vector<Node*>	nodes, flatNodes;
+		Node*				root = BuildTree(nodes, levels);
+		Node*				flatRoot = BuildTree(flatNodes, levels);
+		TransformHierarchy	flat;
+
+		flat.Add(flatRoot, nullptr);
+
+		for (Node* node : flatNodes)
+			flat.Add(node, node->m_parent);
+
+		// Moved nodes drag their subtrees along, both storages must agree on the count
+		root->Update();
+		flat.Update();
+
+		std::printf("%zu nodes, 1%% moved recomputes %zu nodes (graph), %zu nodes (flat)\n", nodes.size(),
+					TransformLoop(nodes, 100, [&] { return root->Update(); }),
+					TransformLoop(flatNodes, 100, [&] { return flat.Update(); }));
+
+		auto run = [&](char const* name, std::function<void()> const& func)
+		{
+			runner.Run(("transform (" + std::string(name) + suffix + ")").c_str(), 1, func);
+		};
+
+		run("graph update", [&] { TransformLoop(nodes, 1, [&] { return root->Update(); }); });
+		run("flat update", [&] { TransformLoop(flatNodes, 1, [&] { return flat.Update(); }); });
+		run("graph, 1% moved", [&] { TransformLoop(nodes, 100, [&] { return root->Update(); }); });
+		run("flat, 1% moved", [&] { TransformLoop(flatNodes, 100, [&] { return flat.Update(); }); });
+		run("graph, static", [&] { Benchmark::KeepAlive(root->Update()); });
+		run("flat, static", [&] { Benchmark::KeepAlive(flat.Update()); });
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner runner("HotLoopBench", argc, argv);
+
+	// Roughly the size of a level, a few hundred colliders
+	std::vector<PhysicsLib::BoxCollider>	boxes;
+	std::vector<PhysicsLib::SphereCollider>	spheres;
+
+	for (int i = 0; i < 512; ++i)
+		boxes.emplace_back(RandomVector(-20.0f, 20.0f), RandomVector(0.25f, 2.0f));
+
+	for (int i = 0; i < 64; ++i)
+		spheres.emplace_back(RandomFloat(0.25f, 2.0f), RandomVector(-20.0f, 20.0f));
+
+	// Collider sync reads the globals of a level sized tree
+	std::vector<Node*>	nodes;
+	Node*				root = BuildTree(nodes, 4);
+
+	root->Update();
+
+	std::printf("HotLoopBench: %zu boxes, %zu spheres, %d repetitions\n",
+				boxes.size(), spheres.size(), runner.Repetitions());
+
+	runner.Run("collision (player)", 1, [&] { CollisionLoop(boxes, spheres); });
+	runner.Run("collision (box pairs)", 1, [&] { BoxPairLoop(boxes); });
+
+	// A level sized tree & one in the tens of thousands of nodes
+	TransformLoops(runner, 4, "");
+	TransformLoops(runner, 5, ", 37k nodes");
+
+	runner.Run("colliders (build & reset)", boxes.size(), [&] { ColliderBuildLoop(boxes); });
+	runner.Run("transform (collider sync)", 1, [&] { ColliderUpdateLoop(boxes, nodes); });
+
+	return runner.Finish();
+}
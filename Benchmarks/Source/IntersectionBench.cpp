@@ -0,0 +1,233 @@
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "LibMath/Intersection.h"
+#include "LibMath/Vector/Vector3.h"
+#include "LibMath/Vector/Vector4.h"
+
+#include "PhysicsLib/CollisionDetection.h"
+#include "PhysicsLib/Frustum.h"
+#include "PhysicsLib/RayCast.h"
+
+#include "Benchmark.hpp"
+
+// Micro benchmark of the LibMath batch intersection kernels against the Physics per collider tests
+// Usage: IntersectionBench [count] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	Benchmark::Random g_random(0x13579bdfu);
+
+	LibMath::Vector3 RandomVector(float min, float max)
+	{
+		return LibMath::Vector3(g_random.Float(min, max), g_random.Float(min, max), g_random.Float(min, max));
+	}
+
+	bool IsSet(std::vector<uint64_t> const& mask, size_t index)
+	{
+		return (mask[index / 64] >> (index % 64)) & 1u;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner	runner("IntersectionBench", argc, argv);
+	size_t				count = (size_t) runner.Positional(0, 4096);
+
+	// Level style boxes, same data as colliders & as structure of arrays
+	std::vector<PhysicsLib::BoxCollider>	colliders;
+	std::vector<float>						minX(count), minY(count), minZ(count), maxX(count), maxY(count), maxZ(count);
+	std::vector<float>						centerX(count), centerY(count), centerZ(count), extentX(count), extentY(count), extentZ(count);
+
+	colliders.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		colliders.emplace_back(RandomVector(-60.f, 60.f), RandomVector(0.25f, 3.f));
+
+		PhysicsLib::BoxCollider const& box = colliders.back();
+
+		minX[i] = box.m_minVertex.m_x;	minY[i] = box.m_minVertex.m_y;	minZ[i] = box.m_minVertex.m_z;
+		maxX[i] = box.m_maxVertex.m_x;	maxY[i] = box.m_maxVertex.m_y;	maxZ[i] = box.m_maxVertex.m_z;
+
+		centerX[i] = box.m_position.m_x;	centerY[i] = box.m_position.m_y;	centerZ[i] = box.m_position.m_z;
+		extentX[i] = box.m_boxScale.m_x;	extentY[i] = box.m_boxScale.m_y;	extentZ[i] = box.m_boxScale.m_z;
+	}
+
+	LibMath::ConstAABBSpan		boxes = { { minX, minY, minZ }, { maxX, maxY, maxZ } };
+	LibMath::ConstVector3Span	centers = { centerX, centerY, centerZ };
+	LibMath::ConstVector3Span	extents = { extentX, extentY, extentZ };
+
+	std::vector<uint64_t>		mask(LibMath::hitMaskSize(count));
+	std::vector<char>			reference(count);
+
+	Ray							ray(LibMath::Vector3(0.5f, 1.f, -70.f), LibMath::Vector3(0.1f, -0.05f, 1.f));
+	PhysicsLib::BoxCollider		player(LibMath::Vector3(2.f, 0.f, -3.f), LibMath::Vector3(8.f, 4.f, 8.f));
+	PhysicsLib::SphereCollider	probe(9.f, LibMath::Vector3(-4.f, 2.f, 5.f));
+
+	// Six planes facing inwards, a 40 unit cube, stands in for a view frustum
+	LibMath::Vector4			planes[6] =
+	{
+		{ 1.f, 0.f, 0.f, -20.f }, { -1.f, 0.f, 0.f, -20.f },
+		{ 0.f, 1.f, 0.f, -20.f }, { 0.f, -1.f, 0.f, -20.f },
+		{ 0.f, 0.f, 1.f, -20.f }, { 0.f, 0.f, -1.f, -20.f }
+	};
+
+	// Scalar frustum reference
+	auto insideFrustum = [&](size_t i)
+	{
+		for (LibMath::Vector4 const& plane : planes)
+		{
+			float distance = centerX[i] * plane.m_x + centerY[i] * plane.m_y + centerZ[i] * plane.m_z - plane.m_w;
+			float radius = extentX[i] * std::fabs(plane.m_x) + extentY[i] * std::fabs(plane.m_y) + extentZ[i] * std::fabs(plane.m_z);
+
+			if (distance < -radius)
+				return false;
+		}
+
+		return true;
+	};
+
+	std::printf("IntersectionBench: %zu boxes, %d repetitions\n", count, runner.Repetitions());
+
+	// Fill reference & mask once outside of the timed runs & count the differences
+	size_t mismatches = 0;
+
+	auto compare = [&](char const* name, auto&& perBox, auto&& batch)
+	{
+		perBox();
+		batch();
+
+		size_t errors = 0;
+
+		for (size_t i = 0; i < count; ++i)
+			errors += IsSet(mask, i) != (reference[i] != 0);
+
+		if (errors)
+			std::printf("%s: %zu mismatches\n", name, errors);
+
+		mismatches += errors;
+	};
+
+	// Ray vs boxes
+	auto rayPerBox = [&]
+	{
+		float distance;
+
+		for (size_t i = 0; i < count; ++i)
+			reference[i] = ray.Intersect(colliders[i], distance);
+	};
+
+	auto rayBatch = [&] { return LibMath::intersectRayAABBs(ray.m_origin, ray.m_inverseDir, boxes, mask); };
+
+	auto rayNearestPerBox = [&]
+	{
+		size_t	nearest = LibMath::noHit;
+		float	closest = FLT_MAX, distance;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (ray.Intersect(colliders[i], distance) && distance < closest)
+			{
+				closest = distance;
+				nearest = i;
+			}
+		}
+
+		return nearest;
+	};
+
+	auto rayNearestBatch = [&]
+	{
+		float distance;
+
+		return LibMath::nearestRayAABB(ray.m_origin, ray.m_inverseDir, boxes, distance);
+	};
+
+	compare("ray", rayPerBox, rayBatch);
+
+	if (rayNearestPerBox() != rayNearestBatch())
+	{
+		std::printf("ray nearest: %zu instead of %zu\n", rayNearestBatch(), rayNearestPerBox());
+		++mismatches;
+	}
+
+	runner.Run("ray (Ray::Intersect)", count, [&] { rayPerBox(); Benchmark::KeepAlive(reference[0]); });
+	runner.Run("ray (batch mask)", count, [&] { Benchmark::KeepAlive((double) rayBatch()); });
+	runner.Run("ray nearest (per box)", count, [&] { Benchmark::KeepAlive((double) rayNearestPerBox()); });
+	runner.Run("ray nearest (batch)", count, [&] { Benchmark::KeepAlive((double) rayNearestBatch()); });
+
+	// Sphere vs boxes
+	auto spherePerBox = [&]
+	{
+		for (size_t i = 0; i < count; ++i)
+			reference[i] = PhysicsLib::SphereCollider::CheckCollision(probe, colliders[i]);
+	};
+
+	auto sphereBatch = [&] { return LibMath::intersectSphereAABBs(probe.m_position, probe.m_radius, boxes, mask); };
+
+	compare("sphere", spherePerBox, sphereBatch);
+
+	runner.Run("sphere (CheckCollision)", count, [&] { spherePerBox(); Benchmark::KeepAlive(reference[0]); });
+	runner.Run("sphere (batch mask)", count, [&] { Benchmark::KeepAlive((double) sphereBatch()); });
+
+	// Box vs boxes
+	auto boxPerBox = [&]
+	{
+		for (size_t i = 0; i < count; ++i)
+			reference[i] = PhysicsLib::BoxCollider::CheckCollision(player, colliders[i]);
+	};
+
+	auto boxBatch = [&] { return LibMath::intersectAABBAABBs(player.m_minVertex, player.m_maxVertex, boxes, mask); };
+
+	compare("box", boxPerBox, boxBatch);
+
+	runner.Run("box (CheckCollision)", count, [&] { boxPerBox(); Benchmark::KeepAlive(reference[0]); });
+	runner.Run("box (batch mask)", count, [&] { Benchmark::KeepAlive((double) boxBatch()); });
+
+	// Frustum vs boxes
+	auto frustumPerBox = [&]
+	{
+		for (size_t i = 0; i < count; ++i)
+			reference[i] = insideFrustum(i);
+	};
+
+	auto frustumBatch = [&] { return LibMath::intersectFrustumAABBs(planes, centers, extents, mask); };
+
+	compare("frustum", frustumPerBox, frustumBatch);
+
+	runner.Run("frustum (per box)", count, [&] { frustumPerBox(); Benchmark::KeepAlive(reference[0]); });
+	runner.Run("frustum (batch mask)", count, [&] { Benchmark::KeepAlive((double) frustumBatch()); });
+
+	// Same planes with the last rejecting plane of each box tested first
+	std::vector<uint8_t>	lastPlanes(count);
+
+	auto frustumCoherent = [&] { return LibMath::cullFrustumAABBs(planes, centers, extents, lastPlanes, mask); };
+
+	compare("frustum coherent", frustumPerBox, frustumCoherent);
+
+	runner.Run("frustum (coherent batch mask)", count, [&] { Benchmark::KeepAlive((double) frustumCoherent()); });
+
+	// Physics frustum, one BoxBV at a time (also adds some leeway, so no comparison)
+	Frustum view;
+
+	for (PLANE plane = NEAR; plane <= BOTTOM; ++plane)
+		view[plane] = Plane(LibMath::Vector3(planes[plane].m_x, planes[plane].m_y, planes[plane].m_z), planes[plane].m_w);
+
+	runner.Run("frustum (Frustum::Intersect)", count, [&]
+	{
+		size_t inside = 0;
+
+		for (size_t i = 0; i < count; ++i)
+			inside += view.Intersect(colliders[i]);
+
+		Benchmark::KeepAlive((double) inside);
+	});
+
+	std::printf("mismatches with per box results: %zu\n", mismatches);
+
+	return mismatches ? 1 : runner.Finish();
+}
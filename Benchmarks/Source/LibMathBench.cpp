@@ -0,0 +1,201 @@
+#include <vector>
+
+#include "LibMath/Angle.h"
+#include "LibMath/Arithmetic.h"
+#include "LibMath/FastMath.h"
+#include "LibMath/Interpolation.h"
+#include "LibMath/Matrix.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Trigonometry.h"
+#include "LibMath/Vector.h"
+
+#include "Benchmark.hpp"
+
+// Per operation timings of the LibMath types, to catch regressions when a kernel is replaced
+// Usage: LibMathBench [count] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	Benchmark::Random g_random(0x5eed1234u);
+
+	LibMath::Vector3 RandomVector(float min, float max)
+	{
+		return LibMath::Vector3(g_random.Float(min, max), g_random.Float(min, max), g_random.Float(min, max));
+	}
+
+	LibMath::Quaternion RandomRotation(void)
+	{
+		return LibMath::Quaternion(LibMath::Radian(g_random.Float(-3.f, 3.f)), RandomVector(-1.f, 1.f).normalizedCopy());
+	}
+
+	LibMath::Matrix4 RandomTransform(void)
+	{
+		return LibMath::Matrix4::Transform(RandomVector(-10.f, 10.f), RandomRotation(), RandomVector(0.5f, 2.f));
+	}
+
+	LibMath::Matrix3 RandomMatrix3(void)
+	{
+		float values[9];
+
+		for (float& value : values)
+			value = g_random.Float(-2.f, 2.f);
+
+		return LibMath::Matrix3(values);
+	}
+
+	// Sum of every element so the whole result is used
+	float Sum(LibMath::Vector3 const& vector)
+	{
+		return vector.m_x + vector.m_y + vector.m_z;
+	}
+
+	float Sum(LibMath::Matrix3 const& matrix)
+	{
+		float total = 0.f;
+
+		for (auto const& row : matrix.m_matrix)
+		{
+			for (float value : row)
+				total += value;
+		}
+
+		return total;
+	}
+
+	float Sum(LibMath::Matrix4 const& matrix)
+	{
+		float total = 0.f;
+
+		for (auto const& row : matrix.m_matrix)
+		{
+			for (float value : row)
+				total += value;
+		}
+
+		return total;
+	}
+
+	// Apply func to every index & keep the sum of its results alive
+	template <typename TFunc>
+	auto ForEach(size_t count, TFunc func)
+	{
+		return [count, func]
+		{
+			float total = 0.f;
+
+			for (size_t i = 0; i < count; ++i)
+				total += func(i);
+
+			Benchmark::KeepAlive(total);
+		};
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner runner("LibMathBench", argc, argv);
+
+	const size_t count = (size_t) runner.Positional(0, 1024);
+
+	// Inputs, same for every run
+	std::vector<LibMath::Vector3>		vectors(count), others(count);
+	std::vector<LibMath::Vector4>		points(count);
+	std::vector<LibMath::Vector2>		points2D(count);
+	std::vector<LibMath::Matrix3>		matrices3(count), others3(count);
+	std::vector<LibMath::Matrix4>		matrices4(count), others4(count);
+	std::vector<LibMath::Quaternion>	rotations(count), otherRotations(count);
+	std::vector<float>					angles(count), ratios(count), sines(count), tangents(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		vectors[i] = RandomVector(-10.f, 10.f);
+		others[i] = RandomVector(-10.f, 10.f);
+		points[i] = LibMath::Vector4(RandomVector(-10.f, 10.f), 1.f);
+		points2D[i] = LibMath::Vector2(g_random.Float(0.f, 1.f), g_random.Float(0.f, 1.f));
+		matrices3[i] = RandomMatrix3();
+		others3[i] = RandomMatrix3();
+		matrices4[i] = RandomTransform();
+		others4[i] = RandomTransform();
+		rotations[i] = RandomRotation();
+		otherRotations[i] = RandomRotation();
+		angles[i] = g_random.Float(-6.f, 6.f);
+		ratios[i] = g_random.Float(0.f, 1.f);
+		sines[i] = g_random.Float(-1.f, 1.f);
+		tangents[i] = g_random.Float(-20.f, 20.f);
+	}
+
+	std::printf("LibMathBench: %zu operations per run, %d repetitions\n\n", count, runner.Repetitions());
+
+	// Vector3
+	runner.Run("Vector3 add", count, ForEach(count, [&](size_t i) { return Sum(vectors[i] + others[i]); }));
+	runner.Run("Vector3 dot", count, ForEach(count, [&](size_t i) { return vectors[i].dot(others[i]); }));
+	runner.Run("Vector3 cross", count, ForEach(count, [&](size_t i) { return Sum(vectors[i].cross(others[i])); }));
+	runner.Run("Vector3 magnitude", count, ForEach(count, [&](size_t i) { return vectors[i].magnitude(); }));
+	runner.Run("Vector3 magnitudeSquared", count, ForEach(count, [&](size_t i) { return vectors[i].magnitudeSquared(); }));
+	runner.Run("Vector3 distanceFrom", count, ForEach(count, [&](size_t i) { return vectors[i].distanceFrom(others[i]); }));
+	runner.Run("Vector3 distanceSquaredFrom", count, ForEach(count, [&](size_t i) { return vectors[i].distanceSquaredFrom(others[i]); }));
+	runner.Run("Vector3 normalizedCopy", count, ForEach(count, [&](size_t i) { return Sum(vectors[i].normalizedCopy()); }));
+	runner.Run("Fast::normalizedCopy", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Fast::normalizedCopy(vectors[i])); }));
+	runner.Run("Vector3 angleFrom", count, ForEach(count, [&](size_t i) { return vectors[i].angleFrom(others[i]).raw(); }));
+
+	// Matrix3
+	runner.Run("Matrix3 multiply", count, ForEach(count, [&](size_t i) { return Sum(matrices3[i] * others3[i]); }));
+	runner.Run("Matrix3 Transpose", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Matrix3().Transpose(matrices3[i])); }));
+	runner.Run("Matrix3 Determinant", count, ForEach(count, [&](size_t i) { return LibMath::Matrix3().Determinant(matrices3[i]); }));
+	runner.Run("Matrix3 Inverse", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Matrix3().Inverse(matrices3[i])); }));
+
+	// Matrix4
+	runner.Run("Matrix4 multiply", count, ForEach(count, [&](size_t i) { return Sum(matrices4[i] * others4[i]); }));
+	runner.Run("Matrix4 * Vector4", count, ForEach(count, [&](size_t i) { LibMath::Vector4 result = matrices4[i] * points[i]; return result.m_x + result.m_y + result.m_z; }));
+	runner.Run("Matrix4 Transpose", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Matrix4().Transpose(matrices4[i])); }));
+	runner.Run("Matrix4 Determinant", count, ForEach(count, [&](size_t i) { return LibMath::Matrix4().Determinant(matrices4[i]); }));
+	runner.Run("Matrix4 GetInverse", count, ForEach(count, [&](size_t i) { return Sum(matrices4[i].GetInverse()); }));
+	runner.Run("Matrix4 GetAffineInverse", count, ForEach(count, [&](size_t i) { return Sum(matrices4[i].GetAffineInverse()); }));
+	runner.Run("Matrix4 Transform", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Matrix4::Transform(vectors[i], rotations[i], others[i])); }));
+	runner.Run("Matrix4 Translate", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Matrix4::Translate(vectors[i])); }));
+	runner.Run("Matrix4 YRotation", count, ForEach(count, [&](size_t i) { return Sum(LibMath::Matrix4::YRotation(angles[i])); }));
+
+	// Quaternion
+	runner.Run("Quaternion multiply", count, ForEach(count, [&](size_t i) { LibMath::Quaternion result = rotations[i] * otherRotations[i]; return result.m_w + result.m_x; }));
+	runner.Run("Quaternion rotate", count, ForEach(count, [&](size_t i) { return Sum(rotations[i].rotate(vectors[i])); }));
+	runner.Run("Quaternion toMatrix4", count, ForEach(count, [&](size_t i) { return Sum(rotations[i].toMatrix4()); }));
+	runner.Run("Quaternion slerp", count, ForEach(count, [&](size_t i) { return LibMath::slerp(rotations[i], otherRotations[i], ratios[i]).m_w; }));
+	runner.Run("Quaternion nlerp", count, ForEach(count, [&](size_t i) { return LibMath::nlerp(rotations[i], otherRotations[i], ratios[i]).m_w; }));
+
+	// Angle
+	runner.Run("Degree to Radian", count, ForEach(count, [&](size_t i) { return LibMath::Radian(LibMath::Degree(angles[i] * 60.f)).raw(); }));
+	runner.Run("Radian radian (wrapped)", count, ForEach(count, [&](size_t i) { return LibMath::Radian(angles[i] * 4.f).radian(); }));
+	runner.Run("Radian degree (wrapped)", count, ForEach(count, [&](size_t i) { return LibMath::Radian(angles[i]).degree(true); }));
+
+	// Trigonometry
+	runner.Run("sin", count, ForEach(count, [&](size_t i) { return LibMath::sin(LibMath::Radian(angles[i])); }));
+	runner.Run("cos", count, ForEach(count, [&](size_t i) { return LibMath::cos(LibMath::Radian(angles[i])); }));
+	runner.Run("tan", count, ForEach(count, [&](size_t i) { return LibMath::tan(LibMath::Radian(angles[i] * 0.25f)); }));
+	runner.Run("asin", count, ForEach(count, [&](size_t i) { return LibMath::asin(sines[i]).raw(); }));
+	runner.Run("acos", count, ForEach(count, [&](size_t i) { return LibMath::acos(sines[i]).raw(); }));
+	runner.Run("atan", count, ForEach(count, [&](size_t i) { return LibMath::atan(tangents[i]).raw(); }));
+	runner.Run("Fast::sin", count, ForEach(count, [&](size_t i) { return LibMath::Fast::sin(angles[i]); }));
+	runner.Run("Fast::cos", count, ForEach(count, [&](size_t i) { return LibMath::Fast::cos(angles[i]); }));
+	runner.Run("Fast::tan", count, ForEach(count, [&](size_t i) { return LibMath::Fast::tan(angles[i] * 0.25f); }));
+	runner.Run("Fast::atan", count, ForEach(count, [&](size_t i) { return LibMath::Fast::atan(tangents[i]); }));
+
+	// Arithmetic & interpolation
+	runner.Run("squareRoot", count, ForEach(count, [&](size_t i) { return LibMath::squareRoot(ratios[i]); }));
+	runner.Run("Fast::inverseSquareRoot", count, ForEach(count, [&](size_t i) { return LibMath::Fast::inverseSquareRoot(ratios[i] + 1.f); }));
+	runner.Run("lerp", count, ForEach(count, [&](size_t i) { return LibMath::lerp(angles[i], tangents[i], ratios[i]); }));
+	runner.Run("getLerpRatio", count, ForEach(count, [&](size_t i) { return LibMath::getLerpRatio(ratios[i], -1.f, 2.f); }));
+
+	const LibMath::Vector2 triangle[3] = { { 0.f, 0.f }, { 1.f, 0.f }, { 0.f, 1.f } };
+
+	runner.Run("getBarycentricWeights", count, ForEach(count, [&](size_t i)
+	{
+		return Sum(LibMath::getBarycentricWeights(triangle[0], triangle[1], triangle[2], points2D[i].m_x, points2D[i].m_y));
+	}));
+
+	runner.Run("tripleBarycentric", count, ForEach(count, [&](size_t i)
+	{
+		return Sum(LibMath::tripleBarycentric(vectors[i], others[i], vectors[i], others[i]));
+	}));
+
+	return runner.Finish();
+}
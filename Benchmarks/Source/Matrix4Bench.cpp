@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Simd.h"
+
+#include "Benchmark.hpp"
+
+// Matrix4 multiply, transpose & inverse kernels (SSE/AVX when enabled) checked against the scalar path, then timed
+// Constant evaluation always takes the scalar path, the runtime random matrices use the same loops copied below
+// Usage: Matrix4Bench [count] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	Benchmark::Random g_random(0x0dd5eedu);
+
+	LibMath::Matrix4 RandomMatrix(void)
+	{
+		LibMath::Matrix4 matrix;
+
+		for (auto& row : matrix.m_matrix)
+		{
+			for (float& value : row)
+				value = g_random.Float(-4.f, 4.f);
+		}
+
+		return matrix;
+	}
+
+	constexpr LibMath::Matrix4 FromRows(const float (&values)[16])
+	{
+		LibMath::Matrix4 matrix;
+
+		for (int i = 0; i < 16; ++i)
+			matrix.m_matrix[i / 4][i % 4] = values[i];
+
+		return matrix;
+	}
+
+	// Scalar multiply & transpose, the non SIMD branches of Matrix4.inl
+	LibMath::Matrix4 ScalarMultiply(const LibMath::Matrix4& matrixA, const LibMath::Matrix4& matrixB)
+	{
+		LibMath::Matrix4 result;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				result.m_matrix[i][j] = 0.0f;
+
+				for (int k = 0; k < 4; ++k)
+					result.m_matrix[i][j] += matrixA.m_matrix[i][k] * matrixB.m_matrix[k][j];
+			}
+		}
+
+		return result;
+	}
+
+	LibMath::Matrix4 ScalarTranspose(const LibMath::Matrix4& matrix)
+	{
+		LibMath::Matrix4 result;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+				result.m_matrix[j][i] = matrix.m_matrix[i][j];
+		}
+
+		return result;
+	}
+
+	// Scalar inverse, the non SIMD branch of Matrix4::GetInverse (cofactor expansion)
+	LibMath::Matrix4 ScalarInverse(const LibMath::Matrix4& matrix)
+	{
+		LibMath::Matrix4 matrixCopy = matrix;
+		LibMath::Matrix4 resultMatrix;
+
+		const float det = resultMatrix.Determinant(matrixCopy);
+
+		if (det == 0.0f)
+			return resultMatrix;
+
+		return matrixCopy.Adjugate(matrixCopy) * (1.0f / det);
+	}
+
+	// Largest element difference relative to the largest element of expected
+	float RelativeError(const LibMath::Matrix4& result, const LibMath::Matrix4& expected)
+	{
+		float error = 0.f, scale = 1.f;
+
+		for (int i = 0; i < 16; ++i)
+		{
+			error = std::max(error, std::fabs(result.m_matrix[i / 4][i % 4] - expected.m_matrix[i / 4][i % 4]));
+			scale = std::max(scale, std::fabs(expected.m_matrix[i / 4][i % 4]));
+		}
+
+		return error / scale;
+	}
+
+	float Sum(const LibMath::Matrix4& matrix)
+	{
+		float total = 0.f;
+
+		for (auto const& row : matrix.m_matrix)
+		{
+			for (float value : row)
+				total += value;
+		}
+
+		return total;
+	}
+
+	// Fixed inputs, results computed at compile time
+	constexpr LibMath::Matrix4 g_left = FromRows({ 1.f, 2.f, 3.f, 4.f, -5.f, 6.f, 7.f, 8.f, 9.f, 10.f, -11.f, 12.f, 13.f, 14.f, 15.f, 16.f });
+	constexpr LibMath::Matrix4 g_right = FromRows({ 0.5f, -1.f, 2.f, 0.f, 3.f, 0.25f, -2.f, 1.f, 1.f, 1.f, 1.f, -1.f, 4.f, 0.f, 2.f, 8.f });
+
+	constexpr LibMath::Matrix4 g_product = g_left * g_right;
+	constexpr LibMath::Matrix4 g_transposed = LibMath::Matrix4(g_left).Transpose(g_left);
+
+	// Singular matrices, the inverse is the identity on both paths
+	const LibMath::Matrix4 g_singular[] =
+	{
+		FromRows({ 1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 4.f, 0.f, 1.f, 0.f, 1.f, 2.f, 0.f, 1.f, 0.f }),		// repeated row
+		FromRows({ 1.f, 2.f, 3.f, 4.f, 0.f, 0.f, 0.f, 0.f, 5.f, 6.f, 7.f, 8.f, 9.f, 1.f, 2.f, 3.f }),		// zero row
+		FromRows({ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f }),	// rank 2
+		FromRows({ 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f })		// zero matrix
+	};
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner	runner("Matrix4Bench", argc, argv);
+	const size_t		count = (size_t) runner.Positional(0, 1024);
+
+#if defined(LIBMATH_AVX)
+	const char* kernels = "AVX";
+#elif defined(LIBMATH_SSE)
+	const char* kernels = "SSE";
+#else
+	const char* kernels = "scalar";
+#endif
+
+	std::printf("Matrix4Bench: %zu matrices, %s kernels, %d repetitions\n", count, kernels, runner.Repetitions());
+
+	std::vector<LibMath::Matrix4>	matrices(count), others(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		matrices[i] = RandomMatrix();
+		others[i] = RandomMatrix();
+	}
+
+	size_t mismatches = 0;
+
+	auto check = [&](const char* name, const LibMath::Matrix4& result, const LibMath::Matrix4& expected, float tolerance)
+	{
+		const float error = RelativeError(result, expected);
+
+		if (error > tolerance)
+		{
+			std::printf("%s: relative error %g\n", name, error);
+			++mismatches;
+		}
+	};
+
+	// Runtime kernels against the compile time scalar results
+	LibMath::Matrix4 left = g_left, right = g_right;
+
+	check("multiply (fixed)", left * right, g_product, 1e-6f);
+	check("transpose (fixed)", LibMath::Matrix4().Transpose(left), g_transposed, 0.f);
+
+	// Runtime kernels against the scalar loops
+	for (size_t i = 0; i < count; ++i)
+	{
+		check("multiply", matrices[i] * others[i], ScalarMultiply(matrices[i], others[i]), 1e-6f);
+		check("transpose", LibMath::Matrix4().Transpose(matrices[i]), ScalarTranspose(matrices[i]), 0.f);
+
+		// Block & cofactor inverses round differently, more so for badly conditioned matrices
+		check("inverse", matrices[i].GetInverse(), ScalarInverse(matrices[i]), 1e-3f);
+	}
+
+	for (const LibMath::Matrix4& singular : g_singular)
+	{
+		check("inverse (singular)", singular.GetInverse(), ScalarInverse(singular), 0.f);
+		check("inverse (singular) identity", singular.GetInverse(), LibMath::Matrix4(), 0.f);
+	}
+
+	std::printf("mismatches with the scalar path: %zu\n", mismatches);
+
+	// Results are stored rather than summed, a serial sum of every element costs more than a multiply
+	std::vector<LibMath::Matrix4> results(count);
+
+	auto forEach = [&](auto func)
+	{
+		return [&, func]
+		{
+			for (size_t i = 0; i < count; ++i)
+				results[i] = func(i);
+
+			Benchmark::KeepAlive(Sum(results[count / 2]));
+		};
+	};
+
+	runner.Run("multiply (kernel)", count, forEach([&](size_t i) { return matrices[i] * others[i]; }));
+	runner.Run("multiply (scalar)", count, forEach([&](size_t i) { return ScalarMultiply(matrices[i], others[i]); }));
+	runner.Run("transpose (kernel)", count, forEach([&](size_t i) { return LibMath::Matrix4().Transpose(matrices[i]); }));
+	runner.Run("transpose (scalar)", count, forEach([&](size_t i) { return ScalarTranspose(matrices[i]); }));
+	runner.Run("inverse (kernel)", count, forEach([&](size_t i) { return matrices[i].GetInverse(); }));
+	runner.Run("inverse (scalar)", count, forEach([&](size_t i) { return ScalarInverse(matrices[i]); }));
+
+	return mismatches ? 1 : runner.Finish();
+}
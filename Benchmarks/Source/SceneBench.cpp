@@ -0,0 +1,238 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Graph.hpp"
+#include "SceneNode.hpp"
+
+#include "Benchmark.hpp"
+
+// Scene traversal as done by ParseScene, type dispatch through dynamic_cast against the OBJECT_TYPE tag,
+// and the per type arrays of SceneComponents that replaced the walk
+// Usage: SceneBench [node count] [--repetitions N] [--warmup N] [--filter text] [--json file]
+
+namespace
+{
+	// Stand-ins for the game objects, no renderer needed
+	class BenchMesh : public ISceneObject
+	{
+	public:
+		BenchMesh(void) { m_type = MESH; }
+	};
+
+	class BenchLight : public ISceneObject
+	{
+	public:
+		BenchLight(void) { m_type = LIGHT; }
+
+		virtual void SetUniforms(float& uniforms) { uniforms += m_intensity; }
+
+		float m_intensity = 0.5f;
+	};
+
+	class BenchBlock : public ISceneObject
+	{
+	public:
+		BenchBlock(void) { m_type = COLOR_BLOCK; }
+
+		void UpdateMovement(float deltaTime) { m_offset += deltaTime; }
+
+		float m_offset = 0.0f;
+	};
+
+	class BenchDoor : public ISceneObject
+	{
+	public:
+		BenchDoor(void) { m_type = DOOR; }
+
+		void UpdateDoorState(int color) { m_open = color == m_color; }
+
+		int		m_color = 1;
+		bool	m_open = false;
+	};
+
+	struct Frame
+	{
+		std::vector<ISceneObject*>	m_meshes;
+		float						m_uniforms = 0.0f;
+	};
+
+	// Same shape as ProcessNode before type tags
+	void ProcessNodeRTTI(SceneNode* node, Frame& frame)
+	{
+		switch (node->m_object->m_type)
+		{
+		case MESH:
+			if (node->m_render)
+				frame.m_meshes.push_back(dynamic_cast<BenchMesh*>(node->m_object));
+			break;
+		case LIGHT:
+			if (BenchLight* light = dynamic_cast<BenchLight*>(node->m_object))
+				light->SetUniforms(frame.m_uniforms);
+			break;
+		case COLOR_BLOCK:
+			dynamic_cast<BenchBlock*>(node->m_object)->UpdateMovement(0.016f);
+			break;
+		case DOOR:
+			dynamic_cast<BenchDoor*>(node->m_object)->UpdateDoorState(1);
+			break;
+		default:
+			break;
+		}
+
+		for (Node* child : node->m_children)
+			ProcessNodeRTTI(dynamic_cast<SceneNode*>(child), frame);
+	}
+
+	// Tag checked static_cast, as ProcessNode does now
+	void ProcessNodeTagged(SceneNode* node, Frame& frame)
+	{
+		switch (node->m_object->m_type)
+		{
+		case MESH:
+			if (node->m_render)
+				frame.m_meshes.push_back(static_cast<BenchMesh*>(node->m_object));
+			break;
+		case LIGHT:
+			static_cast<BenchLight*>(node->m_object)->SetUniforms(frame.m_uniforms);
+			break;
+		case COLOR_BLOCK:
+			static_cast<BenchBlock*>(node->m_object)->UpdateMovement(0.016f);
+			break;
+		case DOOR:
+			static_cast<BenchDoor*>(node->m_object)->UpdateDoorState(1);
+			break;
+		default:
+			break;
+		}
+
+		for (Node* child : node->m_children)
+			ProcessNodeTagged(static_cast<SceneNode*>(child), frame);
+	}
+
+	// Areas of 64 nodes under the world, mostly meshes like the level files
+	void BuildScene(Graph<SceneNode>& scene, size_t nodeCount)
+	{
+		scene.AddChild<BenchMesh>(std::string("world"));
+
+		std::string area;
+
+		for (size_t i = 1; i < nodeCount; ++i)
+		{
+			const std::string key = "node " + std::to_string(i);
+
+			if (i % 64 == 1)
+			{
+				area = key;
+				scene.AddChild<BenchMesh>(std::string("world"), key);
+				continue;
+			}
+
+			switch (i % 16)
+			{
+			case 0:		scene.AddChild<BenchLight>(area, key); break;
+			case 5:		scene.AddChild<BenchBlock>(area, key); break;
+			case 11:	scene.AddChild<BenchDoor>(area, key); break;
+			default:	scene.AddChild<BenchMesh>(area, key); break;
+			}
+		}
+	}
+
+	template <typename TProcess>
+	void TraverseLoop(Graph<SceneNode>& scene, Frame& frame, TProcess&& process)
+	{
+		frame.m_meshes.clear();
+
+		for (SceneNode* node : scene.m_worldRoot->m_children)
+			process(node, frame);
+
+		Benchmark::KeepAlive((double) frame.m_meshes.size() + frame.m_uniforms);
+	}
+
+	// Same switch as ProcessNodeTagged over the graph's cached pre-order, no recursion
+	void PreOrderLoop(Graph<SceneNode>& scene, Frame& frame)
+	{
+		frame.m_meshes.clear();
+
+		for (SceneNode* node : scene.PreOrder())
+		{
+			switch (node->m_object->m_type)
+			{
+			case MESH:
+				if (node->m_render)
+					frame.m_meshes.push_back(node->m_object);
+				break;
+			case LIGHT:
+				static_cast<BenchLight*>(node->m_object)->SetUniforms(frame.m_uniforms);
+				break;
+			case COLOR_BLOCK:
+				static_cast<BenchBlock*>(node->m_object)->UpdateMovement(0.016f);
+				break;
+			case DOOR:
+				static_cast<BenchDoor*>(node->m_object)->UpdateDoorState(1);
+				break;
+			default:
+				break;
+			}
+		}
+
+		Benchmark::KeepAlive((double) frame.m_meshes.size() + frame.m_uniforms);
+	}
+
+	// Same work as ParseScene, one dense array per type
+	void ComponentsLoop(const SceneComponents& components, Frame& frame)
+	{
+		frame.m_meshes.clear();
+
+		components.ForEach<BenchLight>(LIGHT, [&frame](BenchLight* light, SceneNode*) { light->SetUniforms(frame.m_uniforms); });
+		components.ForEach<BenchBlock>(COLOR_BLOCK, [](BenchBlock* block, SceneNode*) { block->UpdateMovement(0.016f); });
+		components.ForEach<BenchDoor>(DOOR, [](BenchDoor* door, SceneNode*) { door->UpdateDoorState(1); });
+
+		components.ForEach<BenchMesh>(MESH, [&frame](BenchMesh* mesh, SceneNode* node)
+		{
+			if (node->m_render)
+				frame.m_meshes.push_back(mesh);
+		});
+
+		Benchmark::KeepAlive((double) frame.m_meshes.size() + frame.m_uniforms);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Runner runner("SceneBench", argc, argv, 100);
+
+	const size_t		nodeCount = (size_t) runner.Positional(0, 50000);
+	SceneComponents		components;
+	Graph<SceneNode>	scene;
+	Frame				frame;
+
+	BuildScene(scene, nodeCount);
+	components.Build(scene);
+	frame.m_meshes.reserve(nodeCount);
+
+	std::printf("SceneBench: %zu nodes, %d repetitions\n", nodeCount, runner.Repetitions());
+
+	runner.Run("traverse (dynamic_cast)", nodeCount, [&] { TraverseLoop(scene, frame, ProcessNodeRTTI); });
+	runner.Run("traverse (type tag)", nodeCount, [&] { TraverseLoop(scene, frame, ProcessNodeTagged); });
+	runner.Run("traverse (cached pre-order)", nodeCount, [&] { PreOrderLoop(scene, frame); });
+	runner.Run("components (per type arrays)", nodeCount, [&] { ComponentsLoop(components, frame); });
+
+	// Projectiles spawned under one parent & despawned oldest first, the worst case of a linear sibling search
+	const size_t		spawnCount = 4096;
+	std::vector<Key>	spawnKeys;
+
+	for (size_t i = 0; i < spawnCount; ++i)
+		spawnKeys.emplace_back("projectile " + std::to_string(i));
+
+	runner.Run("spawn & despawn", spawnCount, [&]
+	{
+		for (Key key : spawnKeys)
+			scene.AddChild<BenchMesh>(Key(std::string("world")), key);
+
+		for (Key key : spawnKeys)
+			scene.DeleteNode(key);
+	});
+
+	return runner.Finish();
+}
@@ -1,7 +1,24 @@
 #pragma once
 
+#include <type_traits>
 #include <unordered_map>
 #include <string>
+#include <vector>
+
+#include "Handle.hpp"
+#include "Key.hpp"
+#include "Node.h"
+#include "TransformHierarchy.h"
+
+// How a graph of Node updates its transforms
+enum class TransformStorage
+{
+	// Recursive walk through each node's children
+	TREE,
+
+	// Depth sorted arrays, one linear pass (see TransformHierarchy)
+	FLAT
+};
 
 template<typename NodeT>
 class Graph
@@ -11,6 +28,11 @@ public:
 	// Create empty graph
 	Graph() = default;
 
+	// Create empty graph with a transform storage mode, FLAT needs NodeT to derive from Node
+	explicit Graph(TransformStorage storage)
+		: m_storage(storage)
+	{}
+
 	// Recursively delete all nodes
 	~Graph()
 	{
@@ -19,30 +41,31 @@ public:
 	}
 
 
+	// Nodes added with a key already in use replace the old node & its subtree
 	template <typename Tobj, typename... TArgs>
-	Tobj* AddChild(const std::string key, const TArgs&... args)
+	Tobj* AddChild(Key key, const TArgs&... args)
 	{
+		ReleaseKey(key);
+
 		// Create object
 		Tobj* newObj = new Tobj(args...);
 
 		// Create node to hold object
 		NodeT* newNode = new NodeT(nullptr, newObj);
 
-
-		if (!m_worldRoot)
-			AddRoot();
-
-		m_worldRoot->AddNode(key, newNode);
-
-		m_worldRoot->m_objects[key] = newNode;
+		InsertNode(key, newNode, nullptr);
+		RegisterHandle(newObj);
 
 		return newObj;
 	}
 
 
 	template <typename Tobj, typename... TArgs>
-	Tobj* AddChild(const std::string parentKey, const std::string key, const TArgs&... args)
+	Tobj* AddChild(Key parentKey, Key key, const TArgs&... args)
 	{
+		// Released first, parent may be in the replaced subtree
+		ReleaseKey(key);
+
 		// Create object
 		Tobj* newObj = new Tobj(args...);
 
@@ -51,22 +74,31 @@ public:
 		// Create node to hold object
 		NodeT* newNode = new NodeT(parent, newObj);
 
+		InsertNode(key, newNode, parent);
+		RegisterHandle(newObj);
 
-		if (!m_worldRoot)
-			AddRoot();
+		return newObj;
+	}
 
-		// Add to parent's vector
-		if (parent)
-			parent->m_children.push_back(newNode);
-		else
-			m_worldRoot->AddNode(key, newNode);
+	// String keys, hashed on every call
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddChild(const std::string& key, const TArgs&... args)
+	{
+		return AddChild<Tobj>(Key(key), args...);
+	}
 
-		m_worldRoot->m_objects[key] = newNode;
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddChild(const std::string& parentKey, const std::string& key, const TArgs&... args)
+	{
+		return AddChild<Tobj>(Key(parentKey), Key(key), args...);
+	}
 
-		return newObj;
+	NodeT* GetNode(const std::string& key)
+	{
+		return GetNode(Key(key));
 	}
 
-	NodeT* GetNode(const std::string key)
+	NodeT* GetNode(Key key)
 	{
 		// Get iterator to object
 		if (!m_worldRoot)
@@ -76,7 +108,7 @@ public:
 
 		// Return resource if it exists
 		if (found != m_worldRoot->m_objects.end())
-			return dynamic_cast<NodeT*>(found->second);
+			return found->second;
 
 		// Return nullptr if it it does not
 		else
@@ -84,85 +116,160 @@ public:
 	}
 
 
+	// Generational handle to a node, stays safe to resolve after the node is deleted
+	Handle<NodeT> GetHandle(Key key)
+	{
+		return Handle<NodeT>(GetNode(key));
+	}
+
 	// Delete a node from its key
-	void DeleteNode(const std::string key)
+	void DeleteNode(const std::string& key)
+	{
+		DeleteNode(Key(key));
+	}
+
+	void DeleteNode(Key key)
 	{
 		// Get node if it exists
-		NodeT* targetNode = m_worldRoot->GetNode(key);
+		NodeT* targetNode = GetNode(key);
 
 		// Delete it from its address
 		if (targetNode)
 			DeleteNode(targetNode);
+	}
 
-		// Get object from hash map
-		auto foundObj = m_worldRoot->m_objects.find(key);
+	// Delete node & its subtree from its address, constant time apart from the subtree itself
+	void DeleteNode(NodeT* target)
+	{
+		// Swap with last sibling & pop, no search through the parent's vector
+		UnlinkChild(target);
+		m_orderDirty = true;
 
-		// Remove it from hash map
-		if (foundObj != m_worldRoot->m_objects.end())
-			m_worldRoot->m_objects.erase(foundObj);
+		// Keys of the subtree would dangle once deleted
+		ForgetKeys(target);
 
+		// Delete calls the recursive Node destructor
+		delete target;
 	}
 
-	// Delete node from its address
-	void DeleteNode(NodeT* target)
+	// Move a node & its subtree under a new parent, nullptr for a parentless node
+	// Node graphs keep the world transform of the moved node, only its local transform changes
+	// (exactly unless non uniform scale & rotation combine into shear)
+	// Return false if newParent is the node or one of its descendants
+	bool Reparent(NodeT* node, NodeT* newParent)
 	{
-		// Delete from parent's vector
-		if (target->m_parent)
+		for (NodeT* ancestor = newParent; ancestor; ancestor = static_cast<NodeT*>(ancestor->m_parent))
 		{
-			auto childIt = target->m_parent->m_children.begin();
+			if (ancestor == node)
+				return false;
+		}
 
-			// Loop through vector
-			while (childIt != target->m_parent->m_children.end())
-			{
-				if (*childIt == target)
-				{
-					// Erase does not call recursive Node destructor
-					target->m_parent->m_children.erase(childIt);
+		if (static_cast<NodeT*>(node->m_parent) == newParent)
+			return true;
 
+		if constexpr (std::is_base_of_v<Node, NodeT>)
+		{
+			// Computed before unlinking, globals may be a frame old
+			const LibMath::Matrix4 global = node->ComputeGlobalTransform();
 
-					break;
-				}
+			MoveChild(node, newParent);
 
-				// Check next iterator
-				else
-					++childIt;
-			}
-		}
+			if (node->m_hierarchy)
+				node->m_hierarchy->Reparent(node, newParent);
 
-		// Delete from world root's vector
+			// Marks the node dirty, its subtree follows on the next update
+			node->SetLocalTransform(newParent ? newParent->ComputeGlobalTransform().GetAffineInverse() * global : global);
+		}
 		else
-		{
-			auto childIt = m_worldRoot->m_children.begin();
+			MoveChild(node, newParent);
 
-			// Loop through vector
-			while (childIt != m_worldRoot->m_children.end())
-			{
-				if (*childIt == target)
-				{
-					// Erase does not call recursive Node destructor
-					m_worldRoot->m_children.erase(childIt);
+		return true;
+	}
 
-					break;
-				}
+	bool Reparent(Key key, Key newParentKey)
+	{
+		NodeT* node = GetNode(key);
 
-				// Check next iterator
-				else
-					++childIt;
-			}
-		}
+		return node && Reparent(node, GetNode(newParentKey));
+	}
 
-		// Delete should call recursive Node destructor
-		target->~NodeT();
-		delete target;
+	bool Reparent(const std::string& key, const std::string& newParentKey)
+	{
+		return Reparent(Key(key), Key(newParentKey));
+	}
 
+	// Every node, parents before children & each subtree contiguous (depth first pre-order)
+	// Cached, only rebuilt after nodes are added, deleted or reparented
+	const std::vector<NodeT*>& PreOrder(void)
+	{
+		if (m_orderDirty)
+			RebuildOrder();
+
+		return m_order;
+	}
+
+	// Index in PreOrder one past the last descendant of PreOrder()[index], jump there to skip the subtree
+	uint32_t SubtreeEnd(uint32_t index)
+	{
+		if (m_orderDirty)
+			RebuildOrder();
+
+		return m_subtreeEnds[index];
 	}
 
 	// Update Graph from world root
 	void UpdateGraph()
 	{
-		// Update root's children
-		if (m_worldRoot)
-			m_worldRoot->Update();
+		m_updatedNodes = 0;
+
+		if constexpr (std::is_base_of_v<Node, NodeT>)
+		{
+			// One pass over the flat arrays
+			if (m_storage == TransformStorage::FLAT)
+			{
+				m_updatedNodes = m_transforms.Update();
+				return;
+			}
+
+			// Update root's children, clean subtrees are skipped
+			if (m_worldRoot)
+				m_updatedNodes = m_worldRoot->Update();
+		}
+		else
+		{
+			// Node types without transforms update themselves one by one
+			for (NodeT* node : PreOrder())
+				node->Update();
+		}
+	}
+
+	// Nodes recomputed by the last UpdateGraph, always 0 for graphs of non Node types
+	size_t UpdatedNodeCount(void) const
+	{
+		return m_updatedNodes;
+	}
+
+	// Switch transform storage, nodes already in the graph are moved to the new one
+	void SetTransformStorage(TransformStorage storage)
+	{
+		static_assert(std::is_base_of_v<Node, NodeT>, "Only graphs of Node have transforms");
+
+		if (storage == m_storage)
+			return;
+
+		m_storage = storage;
+		m_transforms.Clear();
+
+		if (storage == TransformStorage::FLAT && m_worldRoot)
+		{
+			for (NodeT* node : m_worldRoot->m_children)
+				AddTransforms(node, nullptr);
+		}
+	}
+
+	TransformStorage GetTransformStorage(void) const
+	{
+		return m_storage;
 	}
 
 
@@ -178,45 +285,30 @@ public:
 				delete node;
 		}
 
-		// Add parentless node
-		NodeT* AddNode(const std::string key, NodeT* node)
-		{
-			NodeT* found = GetNode(key);
-
-			if (found)
-				delete found;
-
-			if (node && !node->m_parent)
-			{
-				m_children.push_back(node);
-			}
-
-
-			return m_objects[key] = node;
-		}
-
 		// Retrieve node from key
-		NodeT* GetNode(const std::string key)
+		NodeT* GetNode(Key key)
 		{
 			// Get iterator to objects
 			auto found = m_objects.find(key);
 
 			// Return resource if it exists
 			if (found != m_objects.end())
-				return dynamic_cast<NodeT*>(found->second);
+				return found->second;
 
 			// Return nullptr if it it does not
 			else
 				return nullptr;
 		}
 
-		// Update all nodes
-		void Update()
+		// Update all nodes, returns how many transforms were recomputed
+		size_t Update()
 		{
+			size_t updated = 0;
+
 			for (NodeT* node : m_children)
-			{
-				node->Update();
-			}
+				updated += node->Update();
+
+			return updated;
 		}
 
 		void Clear()
@@ -226,7 +318,7 @@ public:
 		}
 
 		// Unordered map to get objects easily
-		std::unordered_map<std::string, NodeT*>				m_objects;
+		std::unordered_map<Key, NodeT*>						m_objects;
 
 	public:
 		// Root's children; parentless nodes
@@ -245,8 +337,165 @@ public:
 
 		// Create new nodes
 		m_worldRoot = new RootNode();
+		m_orderDirty = true;
 	}
 
 	RootNode* m_worldRoot = nullptr;
 
+	// Flat transforms, empty unless storage is FLAT
+	TransformHierarchy	m_transforms;
+
+private:
+
+	// Flatten the tree into m_order, recording where each subtree ends
+	void RebuildOrder(void)
+	{
+		m_order.clear();
+		m_subtreeEnds.clear();
+
+		if (m_worldRoot)
+		{
+			for (NodeT* node : m_worldRoot->m_children)
+				AppendOrder(node);
+		}
+
+		m_orderDirty = false;
+	}
+
+	void AppendOrder(NodeT* node)
+	{
+		const size_t index = m_order.size();
+
+		node->m_orderIndex = static_cast<uint32_t>(index);
+
+		m_order.push_back(node);
+		m_subtreeEnds.push_back(0);
+
+		// Children of a node type are of that type
+		for (auto* child : node->m_children)
+			AppendOrder(static_cast<NodeT*>(child));
+
+		m_subtreeEnds[index] = static_cast<uint32_t>(m_order.size());
+	}
+
+	// Delete node using key, if any
+	void ReleaseKey(Key key)
+	{
+		if (NodeT* found = GetNode(key))
+			DeleteNode(found);
+	}
+
+	// Link a new node to its parent (or the root) & register it under key
+	void InsertNode(Key key, NodeT* node, NodeT* parent)
+	{
+		if (!m_worldRoot)
+			AddRoot();
+
+		node->m_key = key;
+		m_worldRoot->m_objects[key] = node;
+
+		LinkChild(node);
+		m_orderDirty = true;
+
+		AddTransform(node, parent);
+		MarkNewNode(node);
+
+		RegisterHandle(node);
+	}
+
+	// Children vectors store each node's index, so unlinking is swap & pop
+	template<class TChildren>
+	static void PushChild(TChildren& children, NodeT* node)
+	{
+		node->m_childIndex = static_cast<uint32_t>(children.size());
+		children.push_back(node);
+	}
+
+	template<class TChildren>
+	static void PopChild(TChildren& children, NodeT* node)
+	{
+		const uint32_t index = node->m_childIndex;
+
+		// Sibling order is not kept
+		children[index] = children.back();
+		children[index]->m_childIndex = index;
+		children.pop_back();
+	}
+
+	void LinkChild(NodeT* node)
+	{
+		if (node->m_parent)
+			PushChild(node->m_parent->m_children, node);
+		else
+			PushChild(m_worldRoot->m_children, node);
+	}
+
+	void UnlinkChild(NodeT* node)
+	{
+		if (node->m_parent)
+			PopChild(node->m_parent->m_children, node);
+		else
+			PopChild(m_worldRoot->m_children, node);
+	}
+
+	void MoveChild(NodeT* node, NodeT* newParent)
+	{
+		UnlinkChild(node);
+
+		node->m_parent = newParent;
+
+		LinkChild(node);
+		MarkNewNode(node);
+
+		m_orderDirty = true;
+	}
+
+	// Erase keys of a subtree about to be deleted
+	template<class TNode>
+	void ForgetKeys(TNode* node)
+	{
+		auto found = m_worldRoot->m_objects.find(node->m_key);
+
+		if (found != m_worldRoot->m_objects.end() && found->second == node)
+			m_worldRoot->m_objects.erase(found);
+
+		for (auto* child : node->m_children)
+			ForgetKeys(child);
+	}
+
+	// Register a new node in the flat storage
+	void AddTransform(NodeT* node, NodeT* parent)
+	{
+		if constexpr (std::is_base_of_v<Node, NodeT>)
+		{
+			if (m_storage == TransformStorage::FLAT)
+				m_transforms.Add(node, parent);
+		}
+	}
+
+	// Let the tree update walk down to a node added under a clean parent
+	void MarkNewNode(NodeT* node)
+	{
+		if constexpr (std::is_base_of_v<Node, NodeT>)
+			node->MarkAncestorsDirty();
+	}
+
+	// Register a subtree, parents first
+	void AddTransforms(Node* node, Node* parent)
+	{
+		m_transforms.Add(node, parent);
+
+		for (Node* child : node->m_children)
+			AddTransforms(child, node);
+	}
+
+	TransformStorage	m_storage = TransformStorage::TREE;
+
+	// Cached pre-order & subtree ends, see PreOrder
+	std::vector<NodeT*>		m_order;
+	std::vector<uint32_t>	m_subtreeEnds;
+	bool					m_orderDirty = true;
+
+	size_t				m_updatedNodes = 0;
+
 };
\ No newline at end of file
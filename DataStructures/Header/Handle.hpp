@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Slot index & generation of a registered object
+struct HandleId
+{
+	static constexpr uint32_t	invalidIndex = UINT32_MAX;
+
+	bool		IsValid(void) const { return m_index != invalidIndex; }
+	bool		operator==(const HandleId& other) const = default;
+
+	uint32_t	m_index = invalidIndex;
+	uint32_t	m_generation = 0;
+};
+
+/*
+	Registry of live objects sharing a root type (Node, ISceneObject, ...).
+	A removed slot bumps its generation, so handles to a destroyed object
+	resolve to nullptr instead of dangling, and storage that moves objects
+	only has to Relocate them.
+*/
+template <typename TRoot>
+class HandleTable
+{
+public:
+
+	// One table per root type
+	static HandleTable& Instance(void)
+	{
+		static HandleTable	instance;
+
+		return instance;
+	}
+
+	HandleId Add(TRoot* object)
+	{
+		uint32_t index = m_freeList;
+
+		if (index == HandleId::invalidIndex)
+		{
+			index = static_cast<uint32_t>(m_slots.size());
+			m_slots.emplace_back();
+		}
+		else
+			m_freeList = m_slots[index].m_nextFree;
+
+		Slot& slot = m_slots[index];
+
+		slot.m_object = object;
+		++m_live;
+
+		return { index, slot.m_generation };
+	}
+
+	void Remove(HandleId id)
+	{
+		if (!Resolve(id))
+			return;
+
+		Slot& slot = m_slots[id.m_index];
+
+		// Generation 0 is skipped on wrap so a default handle never matches
+		if (++slot.m_generation == 0)
+			slot.m_generation = 1;
+
+		slot.m_object = nullptr;
+		slot.m_nextFree = m_freeList;
+		m_freeList = id.m_index;
+		--m_live;
+	}
+
+	// Object moved to a new address, its handles stay valid
+	void Relocate(HandleId id, TRoot* object)
+	{
+		if (Resolve(id))
+			m_slots[id.m_index].m_object = object;
+	}
+
+	TRoot* Resolve(HandleId id) const
+	{
+		if (id.m_index >= m_slots.size() || m_slots[id.m_index].m_generation != id.m_generation)
+			return nullptr;
+
+		return m_slots[id.m_index].m_object;
+	}
+
+	size_t Live(void) const { return m_live; }
+
+private:
+
+	struct Slot
+	{
+		TRoot*		m_object = nullptr;
+		uint32_t	m_generation = 1;
+		uint32_t	m_nextFree = HandleId::invalidIndex;
+	};
+
+	HandleTable(void) = default;
+
+	std::vector<Slot>	m_slots;
+	uint32_t			m_freeList = HandleId::invalidIndex;
+	size_t				m_live = 0;
+};
+
+/*
+	Member of a root type holding the object's handle id. Copies are not
+	registered, destroying a registered object invalidates its handles.
+*/
+template <typename TRoot>
+class HandleOwner
+{
+public:
+
+	HandleOwner(void) = default;
+	HandleOwner(const HandleOwner&) {}
+
+	HandleOwner& operator=(const HandleOwner&) { return *this; }
+
+	~HandleOwner(void)
+	{
+		if (m_id.IsValid())
+			HandleTable<TRoot>::Instance().Remove(m_id);
+	}
+
+	HandleId	m_id;
+};
+
+// Register an object so handles can point to it, types without a HandleRoot are skipped
+template <typename T>
+void RegisterHandle(T* object)
+{
+	if constexpr (requires { typename T::HandleRoot; })
+	{
+		using Root = typename T::HandleRoot;
+
+		if (!object->m_handle.m_id.IsValid())
+			object->m_handle.m_id = HandleTable<Root>::Instance().Add(static_cast<Root*>(object));
+	}
+}
+
+/*
+	Generational reference to a graph owned object, resolved in O(1) through
+	the table of T's root type. Implicitly built from a pointer so objects
+	returned by AddChild or AddCollider can be stored directly.
+*/
+template <typename T>
+class Handle
+{
+public:
+
+	Handle(void) = default;
+
+	Handle(T* object)
+	{
+		if (object)
+			m_id = object->m_handle.m_id;
+	}
+
+	// Handle to a derived type converts to a handle to its base
+	template <typename U> requires std::is_convertible_v<U*, T*>
+	Handle(const Handle<U>& other)
+		: m_id(other.Id())
+	{}
+
+	// nullptr once the object was destroyed
+	T* Get(void) const
+	{
+		using Root = typename T::HandleRoot;
+
+		return static_cast<T*>(HandleTable<Root>::Instance().Resolve(m_id));
+	}
+
+	T*			operator->(void) const { return Get(); }
+	T&			operator*(void) const { return *Get(); }
+	explicit	operator bool(void) const { return Get() != nullptr; }
+
+	bool		operator==(const Handle& other) const = default;
+
+	HandleId	Id(void) const { return m_id; }
+
+private:
+
+	HandleId	m_id;
+};
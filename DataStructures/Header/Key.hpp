@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Interned name of a node or resource: 64 bit FNV-1a hash of the string.
+// "name"_key is hashed at compile time, lookups with it neither allocate nor hash.
+// Debug builds keep a hash -> name table to print keys & report collisions
+class Key
+{
+public:
+
+	// Empty key, never returned by a name
+	constexpr Key(void) = default;
+
+	// Hash name, explicit so string literals keep picking the std::string overloads
+	constexpr explicit Key(std::string_view name)
+		: m_hash(Hash(name))
+	{
+#ifndef NDEBUG
+		if (!std::is_constant_evaluated())
+			Register(m_hash, name);
+#endif
+	}
+
+	explicit Key(const std::string& name)
+		: Key(std::string_view(name))
+	{}
+
+	constexpr uint64_t Value(void) const { return m_hash; }
+
+	constexpr bool operator==(const Key& other) const = default;
+
+	// Name the key was made from at runtime, empty in release builds or if never seen
+	const char* Name(void) const;
+
+	// FNV-1a, 64 bit
+	static constexpr uint64_t Hash(std::string_view name)
+	{
+		uint64_t hash = 0xcbf29ce484222325ull;
+
+		for (char character : name)
+		{
+			hash ^= static_cast<uint8_t>(character);
+			hash *= 0x100000001b3ull;
+		}
+
+		return hash;
+	}
+
+private:
+
+	// Save name in debug table, warn if another name has the same hash
+	static void Register(uint64_t hash, std::string_view name);
+
+	uint64_t m_hash = 0;
+};
+
+// Compile time key: GetNode("camera"_key)
+consteval Key operator""_key(const char* name, size_t length)
+{
+	return Key(std::string_view(name, length));
+}
+
+// Keys are already hashed
+template <>
+struct std::hash<Key>
+{
+	size_t operator()(const Key& key) const noexcept
+	{
+		return static_cast<size_t>(key.Value());
+	}
+};
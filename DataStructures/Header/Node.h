@@ -1,14 +1,24 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
 #include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Matrix/Matrix3.h"
+#include "LibMath/Quaternion.h"
+
+#include "Handle.hpp"
+#include "Key.hpp"
+#include "TransformHierarchy.h"
 
 class Node
 {
 public:
 
+    // Handles to any node type resolve through the Node table
+    using HandleRoot = Node;
+
     // Create empty node
     Node(void) = default;
 
@@ -22,17 +32,84 @@ public:
     // Debug print node tree
     void PrintNodes(Node* parentNode); // TODO: debug function remove
 
-    // Update node matrices
-    void Update(void);
+    // Update matrices of moved nodes & their descendants, returns how many were recomputed
+    size_t Update(void);
+
+    // Recompute normal matrix from global transform
+    void UpdateNormalMatrix(void);
+
+    // Transposed inverse of a global transform's 3x3
+    static LibMath::Matrix3 NormalMatrix(const LibMath::Matrix4& globalTransform);
+
+    // Compose local transform from translation, rotation & scale, called on dirty nodes only
+    void UpdateLocalTransform(void);
+
+    // Flag local transform as changed, call after setting translation, rotation or scale
+    void MarkDirty(void);
+
+    // Flag ancestors so Update walks down to this node
+    void MarkAncestorsDirty(void);
+
+    // Set translation, rotation & scale from an affine matrix (no shear) & mark dirty
+    void SetLocalTransform(const LibMath::Matrix4& transform);
+
+    // Global transform from the current local components, even if not updated yet
+    LibMath::Matrix4 ComputeGlobalTransform(void) const;
+
+    // Matrices as of the last update, held by the flat storage while the node is registered in one
+    // (references into it are valid until the next node is added)
+    const LibMath::Matrix4& GetGlobalTransform(void) const
+    {
+        return m_hierarchy ? m_hierarchy->m_global[m_hierarchyIndex] : m_globalTransform;
+    }
 
+    const LibMath::Matrix4& GetLocalTransform(void) const
+    {
+        return m_hierarchy ? m_hierarchy->m_local[m_hierarchyIndex] : m_localTransform;
+    }
 
+    const LibMath::Matrix3& GetNormalMatrix(void) const
+    {
+        return m_hierarchy ? m_hierarchy->m_normal[m_hierarchyIndex] : m_normalMatrix;
+    }
+
+
+    // Tree storage matrices, read them through the getters above
     LibMath::Matrix4        m_globalTransform;
     LibMath::Matrix4        m_localTransform;
 
+    // Local transform components, set dirty after changing them
+    LibMath::Vector3        m_translation;
+    LibMath::Quaternion     m_rotation;
+    LibMath::Vector3        m_scale = LibMath::Vector3::one();
+
+    // Transposed inverse of the global 3x3, only updated along with m_globalTransform
+    LibMath::Matrix3        m_normalMatrix;
+
     std::vector<Node*>      m_children;
 
     Node*                   m_parent = nullptr;
 
+    // Key in its graph, position in the parent's children & in the graph's pre-order, set by Graph
+    Key                     m_key;
+    uint32_t                m_childIndex = 0;
+    uint32_t                m_orderIndex = 0;
+
+    // Set once a graph registers the node
+    HandleOwner<Node>       m_handle;
+
+    // Flat storage this node is registered in, if its graph uses one
+    TransformHierarchy*     m_hierarchy = nullptr;
+    uint32_t                m_hierarchyIndex = 0;
+
+    // Bumped whenever m_globalTransform is recomputed, children compare it to m_parentVersion
+    uint32_t                m_version = 0;
+    uint32_t                m_parentVersion = 0;
+
+    // Tree storage flags, see TransformHierarchy::m_dirty for the flat storage
     bool                    m_dirty = true;
+
+    // This node or a descendant needs recomputing, clean subtrees are skipped
+    bool                    m_subtreeDirty = true;
     bool                    m_render = true;
 };
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+/*
+	Typed pool handing out storage for one T at a time. Storage comes from
+	large slabs of TSlabSize objects, freed objects go on a free list & are
+	reused first, so objects of one type sit next to each other in memory and
+	loading a level costs a few slab allocations instead of one per object.
+
+	Classes opt in by routing their operator new & delete to New & Delete.
+	Derived classes of a different size fall back to the global heap unless
+	they declare their own operators.
+*/
+template <typename T, size_t TSlabSize = 256>
+class SlabAllocator
+{
+public:
+
+	// One pool per type, destroyed after every object allocated in it
+	static SlabAllocator& Instance(void)
+	{
+		static SlabAllocator	instance;
+
+		return instance;
+	}
+
+	// operator new of pooled classes
+	static void* New(size_t size)
+	{
+		if (size != sizeof(T))
+			return ::operator new(size);
+
+		return Instance().Allocate();
+	}
+
+	// operator delete of pooled classes
+	static void Delete(void* ptr, size_t size)
+	{
+		if (!ptr)
+			return;
+
+		if (size != sizeof(T))
+			::operator delete(ptr);
+		else
+			Instance().Free(ptr);
+	}
+
+	~SlabAllocator(void)
+	{
+		Release();
+	}
+
+	// Storage for one object, constructed by the caller
+	void* Allocate(void)
+	{
+		if (!m_freeList)
+			AddSlab();
+
+		Slot* slot = m_freeList;
+
+		m_freeList = slot->m_next;
+		++m_live;
+
+		return slot->m_storage;
+	}
+
+	// Give back storage of an already destroyed object
+	void Free(void* ptr)
+	{
+		Slot* slot = static_cast<Slot*>(ptr);
+
+		slot->m_next = m_freeList;
+		m_freeList = slot;
+		--m_live;
+	}
+
+	// Allocate slabs up front for at least count objects
+	void Reserve(size_t count)
+	{
+		while (Capacity() < count)
+			AddSlab();
+	}
+
+	// Bulk release, frees every slab at once, only valid once all objects are destroyed
+	void Release(void)
+	{
+		if (m_live)
+			return;
+
+		m_slabs.clear();
+		m_freeList = nullptr;
+	}
+
+	size_t Live(void) const { return m_live; }
+	size_t Capacity(void) const { return m_slabs.size() * TSlabSize; }
+
+private:
+
+	union Slot
+	{
+		Slot*					m_next;
+		alignas(T) std::byte	m_storage[sizeof(T)];
+	};
+
+	SlabAllocator(void) = default;
+
+	void AddSlab(void)
+	{
+		std::unique_ptr<Slot[]>	slab = std::make_unique<Slot[]>(TSlabSize);
+
+		// Thread the new slots in address order
+		for (size_t index = 0; index + 1 < TSlabSize; ++index)
+			slab[index].m_next = &slab[index + 1];
+
+		slab[TSlabSize - 1].m_next = m_freeList;
+		m_freeList = &slab[0];
+
+		m_slabs.push_back(std::move(slab));
+	}
+
+	std::vector<std::unique_ptr<Slot[]>>	m_slabs;
+	Slot*									m_freeList = nullptr;
+	size_t									m_live = 0;
+};
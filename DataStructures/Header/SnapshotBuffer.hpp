@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Flat bytes of trivially copyable values, read back in the order they were written
+class SnapshotBuffer
+{
+public:
+
+	SnapshotBuffer(void) = default;
+
+	template<typename T>
+	void Write(const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Snapshot values are copied as raw bytes");
+
+		const size_t offset = m_data.size();
+
+		m_data.resize(offset + sizeof(T));
+		std::memcpy(m_data.data() + offset, &value, sizeof(T));
+	}
+
+	// Return false & leave value untouched past the end of the data
+	template<typename T>
+	bool Read(T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Snapshot values are copied as raw bytes");
+
+		if (m_cursor + sizeof(T) > m_data.size())
+			return false;
+
+		std::memcpy(&value, m_data.data() + m_cursor, sizeof(T));
+		m_cursor += sizeof(T);
+
+		return true;
+	}
+
+	// Read from the start again
+	void	Rewind(void) { m_cursor = 0; }
+
+	// Drop data, capacity is kept for the next capture
+	void	Clear(void) { m_data.clear(); m_cursor = 0; }
+
+	size_t	Size(void) const { return m_data.size(); }
+
+	// Every value written was read back
+	bool	AtEnd(void) const { return m_cursor == m_data.size(); }
+	bool	Empty(void) const { return m_data.empty(); }
+
+private:
+
+	std::vector<unsigned char>	m_data;
+	size_t						m_cursor = 0;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Matrix/Matrix3.h"
+
+class Node;
+
+/*
+	Flat storage of a node tree's transforms. Local, global & normal matrices,
+	parent indices & dirty flags live in arrays sorted by depth, so a parent
+	always comes before its children and Update is one linear pass instead of
+	a recursive walk.
+
+	Registered nodes read their matrices from the arrays (Node::GetGlobalTransform),
+	a node is only dereferenced to compose its local matrix after it was moved.
+*/
+class TransformHierarchy
+{
+public:
+
+	static constexpr uint32_t	noParent = UINT32_MAX;
+	static constexpr uint32_t	noIndex = UINT32_MAX;
+
+	// Dirty flags, a moved node recomputes its local matrix, a child of a changed node only its global one
+	static constexpr uint8_t	moved = 1;
+	static constexpr uint8_t	parentMoved = 2;
+
+	TransformHierarchy(void) = default;
+
+	// Forget every node (does not delete them)
+	~TransformHierarchy(void);
+
+	// Register node, parent must already be registered (or nullptr)
+	void		Add(Node* node, Node* parent);
+
+	// Unregister node, its children have to be removed as well
+	void		Remove(Node* node);
+
+	// Move node under a registered parent (or nullptr), its subtree gets the new depths
+	void		Reparent(Node* node, Node* parent);
+
+	// Flag node's local transform as changed
+	void		MarkDirty(uint32_t index)
+	{
+		m_dirty[index] |= moved;
+
+		if (index < m_firstDirty)
+			m_firstDirty = index;
+	}
+
+	// Recompute changed transforms, children of a changed node are recomputed too
+	// Returns how many nodes were recomputed
+	size_t		Update(void);
+
+	// Unregister all nodes, their matrices are copied back to them
+	void		Clear(void);
+
+	size_t		Size(void) const { return m_nodes.size(); }
+
+	// Depth sorted arrays, valid until the next Add/Remove
+	std::vector<Node*>				m_nodes;
+	std::vector<uint32_t>			m_parents;
+	std::vector<uint32_t>			m_depths;
+	std::vector<uint8_t>			m_dirty;
+
+	std::vector<LibMath::Matrix4>	m_local;
+	std::vector<LibMath::Matrix4>	m_global;
+	std::vector<LibMath::Matrix3>	m_normal;
+
+private:
+
+	// Drop removed nodes & sort by depth, stable so siblings keep their order
+	void		Rebuild(void);
+
+	bool		m_needsRebuild = false;
+
+	// First flagged node since the last update, nodes before it cannot be affected
+	// noIndex when nothing moved, a static scene skips the pass
+	uint32_t	m_firstDirty = noIndex;
+};
@@ -0,0 +1,32 @@
+#include <cstdio>
+#include <unordered_map>
+
+#include "Key.hpp"
+
+namespace
+{
+	// Debug name table, only filled by keys hashed at runtime
+	std::unordered_map<uint64_t, std::string>& Names(void)
+	{
+		static std::unordered_map<uint64_t, std::string> names;
+
+		return names;
+	}
+}
+
+const char* Key::Name(void) const
+{
+	auto found = Names().find(m_hash);
+
+	return found != Names().end() ? found->second.c_str() : "";
+}
+
+void Key::Register(uint64_t hash, std::string_view name)
+{
+	auto [found, inserted] = Names().try_emplace(hash, name);
+
+	// Two names sharing a hash would share a node
+	if (!inserted && found->second != name)
+		std::printf("Key collision: '%s' and '%.*s' share hash %016llx\n", found->second.c_str(),
+					static_cast<int>(name.size()), name.data(), static_cast<unsigned long long>(hash));
+}
@@ -1,19 +1,17 @@
+#include <cmath>
 #include <iostream>
 #include "LibMath/Matrix/Matrix4.h"
 #include "Node.h"
+#include "TransformHierarchy.h"
 
 Node::~Node(void)
 {
-    for (Node* child : m_children)
-    {
-        if (child)
-        {
-            child->~Node();
-            delete child;
-        }
-    }
+    if (m_hierarchy)
+        m_hierarchy->Remove(this);
 
-    m_children.~vector();
+    // Virtual destructor, derived children are destroyed once through delete
+    for (Node* child : m_children)
+        delete child;
 }
 
 void Node::PrintNodes(Node* parentNode)
@@ -42,25 +40,173 @@ void Node::PrintNodes(Node* parentNode)
     }
 }
 
-void Node::Update(void)
+size_t Node::Update(void)
 {
-    if (m_dirty && !m_parent)
-        m_globalTransform = m_localTransform;
+    size_t updated = 0;
 
-    for (Node* node : m_children)
+    // Parent was recomputed since this node last was
+    const bool parentMoved = m_parent && m_parentVersion != m_parent->m_version;
+
+    if (m_dirty || parentMoved)
     {
-        // Update global transform
-        if (node->m_dirty)
-        {
-            node->m_globalTransform = m_globalTransform * node->m_localTransform;
-            node->m_dirty = false;
-        }
+        if (m_dirty)
+            UpdateLocalTransform();
 
-        // Check recursively through children nodes
-        if (node->m_children.size() > 0)
+        if (m_parent)
         {
-            node->Update();
+            m_globalTransform = m_parent->m_globalTransform * m_localTransform;
+            m_parentVersion = m_parent->m_version;
         }
+        else
+            m_globalTransform = m_localTransform;
+
+        UpdateNormalMatrix();
+
+        ++m_version;
+        m_dirty = false;
+        updated = 1;
+    }
+
+    // Nothing moved below, skip the whole subtree
+    else if (!m_subtreeDirty)
+        return 0;
+
+    // Check recursively through children nodes
+    for (Node* node : m_children)
+        updated += node->Update();
+
+    m_subtreeDirty = false;
+
+    return updated;
+}
+
+void Node::MarkDirty(void)
+{
+    // Flat storage keeps its own flags, the node itself is not touched
+    if (m_hierarchy)
+    {
+        m_hierarchy->MarkDirty(m_hierarchyIndex);
+        return;
+    }
+
+    m_dirty = true;
+
+    MarkAncestorsDirty();
+}
+
+void Node::MarkAncestorsDirty(void)
+{
+    // Stop at the first flagged ancestor, its own ancestors are flagged already
+    for (Node* node = m_parent; node && !node->m_subtreeDirty; node = node->m_parent)
+        node->m_subtreeDirty = true;
+}
+
+void Node::SetLocalTransform(const LibMath::Matrix4& transform)
+{
+    const auto& matrix = transform.m_matrix;
+
+    // Rows hold the scaled axes & the translation, see Matrix4::Transform
+    float scale[3];
+
+    for (int i = 0; i < 3; ++i)
+        scale[i] = std::sqrt(matrix[i][0] * matrix[i][0] + matrix[i][1] * matrix[i][1] + matrix[i][2] * matrix[i][2]);
+
+    // Mirrored basis, flip one axis so the rest is a rotation
+    const float determinant = matrix[0][0] * (matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1])
+                            - matrix[0][1] * (matrix[1][0] * matrix[2][2] - matrix[1][2] * matrix[2][0])
+                            + matrix[0][2] * (matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0]);
+
+    if (determinant < 0.f)
+        scale[0] = -scale[0];
+
+    float r[3][3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+            r[i][j] = scale[i] != 0.f ? matrix[i][j] / scale[i] : (i == j ? 1.f : 0.f);
+    }
+
+    // Inverse of Quaternion::toMatrix3, largest component first for precision
+    float x, y, z, w;
+    const float trace = r[0][0] + r[1][1] + r[2][2];
+
+    if (trace > 0.f)
+    {
+        const float s = 2.f * std::sqrt(trace + 1.f);
+
+        w = 0.25f * s;
+        x = (r[1][2] - r[2][1]) / s;
+        y = (r[2][0] - r[0][2]) / s;
+        z = (r[0][1] - r[1][0]) / s;
+    }
+    else if (r[0][0] > r[1][1] && r[0][0] > r[2][2])
+    {
+        const float s = 2.f * std::sqrt(1.f + r[0][0] - r[1][1] - r[2][2]);
+
+        w = (r[1][2] - r[2][1]) / s;
+        x = 0.25f * s;
+        y = (r[0][1] + r[1][0]) / s;
+        z = (r[2][0] + r[0][2]) / s;
+    }
+    else if (r[1][1] > r[2][2])
+    {
+        const float s = 2.f * std::sqrt(1.f + r[1][1] - r[0][0] - r[2][2]);
+
+        w = (r[2][0] - r[0][2]) / s;
+        x = (r[0][1] + r[1][0]) / s;
+        y = 0.25f * s;
+        z = (r[1][2] + r[2][1]) / s;
+    }
+    else
+    {
+        const float s = 2.f * std::sqrt(1.f + r[2][2] - r[0][0] - r[1][1]);
+
+        w = (r[0][1] - r[1][0]) / s;
+        x = (r[2][0] + r[0][2]) / s;
+        y = (r[1][2] + r[2][1]) / s;
+        z = 0.25f * s;
+    }
+
+    m_translation = LibMath::Vector3(matrix[3][0], matrix[3][1], matrix[3][2]);
+    m_rotation = LibMath::Quaternion(x, y, z, w);
+    m_scale = LibMath::Vector3(scale[0], scale[1], scale[2]);
+
+    MarkDirty();
+}
+
+LibMath::Matrix4 Node::ComputeGlobalTransform(void) const
+{
+    LibMath::Matrix4 global = LibMath::Matrix4::Transform(m_translation, m_rotation, m_scale);
+
+    // Same order as Update, parent on the left
+    for (const Node* node = m_parent; node; node = node->m_parent)
+        global = LibMath::Matrix4::Transform(node->m_translation, node->m_rotation, node->m_scale) * global;
+
+    return global;
+}
+
+void Node::UpdateLocalTransform(void)
+{
+    m_localTransform = LibMath::Matrix4::Transform(m_translation, m_rotation, m_scale);
+}
+
+void Node::UpdateNormalMatrix(void)
+{
+    m_normalMatrix = NormalMatrix(m_globalTransform);
+}
+
+LibMath::Matrix3 Node::NormalMatrix(const LibMath::Matrix4& globalTransform)
+{
+    // Translation does not affect normals, affine inverse is enough
+    LibMath::Matrix4 inverse = globalTransform.GetAffineInverse();
+    LibMath::Matrix3 normalMatrix;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+            normalMatrix.m_matrix[i][j] = inverse.m_matrix[j][i];
     }
 
+    return normalMatrix;
 }
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <cstring>
+
+#include "TransformHierarchy.h"
+#include "Node.h"
+
+TransformHierarchy::~TransformHierarchy(void)
+{
+	Clear();
+}
+
+void TransformHierarchy::Add(Node* node, Node* parent)
+{
+	uint32_t parentIndex = noParent;
+
+	if (parent && parent->m_hierarchy == this)
+		parentIndex = parent->m_hierarchyIndex;
+
+	node->m_hierarchy = this;
+	node->m_hierarchyIndex = static_cast<uint32_t>(m_nodes.size());
+
+	// Appending keeps parents before children, depth order is restored on the next update
+	m_nodes.push_back(node);
+	m_parents.push_back(parentIndex);
+	m_depths.push_back(parentIndex == noParent ? 0 : m_depths[parentIndex] + 1);
+	m_dirty.push_back(0);
+
+	MarkDirty(node->m_hierarchyIndex);
+
+	// Keep the node's current matrices, it is recomputed on the next update anyway
+	m_local.push_back(node->m_localTransform);
+	m_global.push_back(node->m_globalTransform);
+	m_normal.push_back(node->m_normalMatrix);
+
+	if (parentIndex != noParent && m_depths.back() < m_depths[m_depths.size() - 2])
+		m_needsRebuild = true;
+}
+
+void TransformHierarchy::Remove(Node* node)
+{
+	if (node->m_hierarchy != this)
+		return;
+
+	// Leave a hole, compacted by the next rebuild
+	m_nodes[node->m_hierarchyIndex] = nullptr;
+	node->m_hierarchy = nullptr;
+
+	m_needsRebuild = true;
+}
+
+void TransformHierarchy::Reparent(Node* node, Node* parent)
+{
+	if (node->m_hierarchy != this)
+		return;
+
+	const uint32_t index = node->m_hierarchyIndex;
+
+	m_parents[index] = parent && parent->m_hierarchy == this ? parent->m_hierarchyIndex : noParent;
+
+	// Depths below the node shift by the same amount
+	std::vector<Node*> stack = { node };
+
+	while (!stack.empty())
+	{
+		Node* current = stack.back();
+		stack.pop_back();
+
+		const uint32_t parentIndex = m_parents[current->m_hierarchyIndex];
+
+		m_depths[current->m_hierarchyIndex] = parentIndex == noParent ? 0 : m_depths[parentIndex] + 1;
+
+		stack.insert(stack.end(), current->m_children.begin(), current->m_children.end());
+	}
+
+	// A parent may now come after its children
+	MarkDirty(index);
+	m_needsRebuild = true;
+}
+
+size_t TransformHierarchy::Update(void)
+{
+	if (m_needsRebuild)
+		Rebuild();
+
+	if (m_firstDirty == noIndex)
+		return 0;
+
+	const size_t	first = m_firstDirty;
+	const size_t	count = m_nodes.size();
+	size_t			updated = 0;
+
+	// Flag children of changed nodes first, parents come before them so one pass reaches every descendant
+	// Kept apart from the recompute, checking parents there mispredicted on every clean node
+	for (size_t index = first; index < count; ++index)
+	{
+		const uint32_t parent = m_parents[index];
+
+		if (parent != noParent)
+			m_dirty[index] |= m_dirty[parent] ? parentMoved : 0;
+	}
+
+	for (size_t index = first; index < count; ++index)
+	{
+		// Skip clean runs 8 flags at a time, few nodes move in a frame
+		if (index + 8 <= count)
+		{
+			uint64_t flags8;
+			std::memcpy(&flags8, m_dirty.data() + index, sizeof(flags8));
+
+			if (!flags8)
+			{
+				index += 7;
+				continue;
+			}
+		}
+
+		const uint8_t	flags = m_dirty[index];
+		const uint32_t	parent = m_parents[index];
+
+		if (!flags)
+			continue;
+
+		// Local matrix only changes when the node itself was moved, children of a moved node stay in the arrays
+		if (flags & moved)
+		{
+			const Node* node = m_nodes[index];
+
+			m_local[index] = LibMath::Matrix4::Transform(node->m_translation, node->m_rotation, node->m_scale);
+		}
+
+		if (parent == noParent)
+			m_global[index] = m_local[index];
+		else
+			m_global[index] = m_global[parent] * m_local[index];
+
+		m_normal[index] = Node::NormalMatrix(m_global[index]);
+
+		m_dirty[index] = 0;
+		++updated;
+	}
+
+	m_firstDirty = noIndex;
+
+	return updated;
+}
+
+void TransformHierarchy::Clear(void)
+{
+	// Nodes go back to reading their own matrices
+	for (size_t index = 0; index < m_nodes.size(); ++index)
+	{
+		Node* node = m_nodes[index];
+
+		if (!node)
+			continue;
+
+		node->m_localTransform = m_local[index];
+		node->m_globalTransform = m_global[index];
+		node->m_normalMatrix = m_normal[index];
+		node->m_hierarchy = nullptr;
+
+		// Moved since the last update, the tree walk picks it up instead
+		if (m_dirty[index])
+		{
+			node->m_dirty = true;
+			node->MarkAncestorsDirty();
+		}
+	}
+
+	m_nodes.clear();
+	m_parents.clear();
+	m_depths.clear();
+	m_dirty.clear();
+	m_local.clear();
+	m_global.clear();
+	m_normal.clear();
+
+	m_needsRebuild = false;
+	m_firstDirty = noIndex;
+}
+
+void TransformHierarchy::Rebuild(void)
+{
+	const size_t			count = m_nodes.size();
+
+	// Removed parents also removed their children, a live node never points to a hole
+	std::vector<uint32_t>	depthCounts;
+
+	for (size_t index = 0; index < count; ++index)
+	{
+		if (!m_nodes[index])
+			continue;
+
+		if (m_depths[index] >= depthCounts.size())
+			depthCounts.resize(m_depths[index] + 1, 0);
+
+		++depthCounts[m_depths[index]];
+	}
+
+	// Counting sort by depth, first slot of each depth
+	std::vector<uint32_t>	depthStarts(depthCounts.size(), 0);
+	uint32_t				liveCount = 0;
+
+	for (size_t depth = 0; depth < depthCounts.size(); ++depth)
+	{
+		depthStarts[depth] = liveCount;
+		liveCount += depthCounts[depth];
+	}
+
+	std::vector<uint32_t>	remap(count, noParent);
+
+	for (size_t index = 0; index < count; ++index)
+	{
+		if (m_nodes[index])
+			remap[index] = depthStarts[m_depths[index]]++;
+	}
+
+	std::vector<Node*>		nodes(liveCount);
+	std::vector<uint32_t>	parents(liveCount);
+	std::vector<uint32_t>	depths(liveCount);
+	std::vector<uint8_t>	dirty(liveCount);
+
+	std::vector<LibMath::Matrix4>	local(liveCount);
+	std::vector<LibMath::Matrix4>	global(liveCount);
+	std::vector<LibMath::Matrix3>	normal(liveCount);
+
+	// Flagged nodes moved, the first one has to be found again
+	uint32_t				firstDirty = noIndex;
+
+	for (size_t index = 0; index < count; ++index)
+	{
+		const uint32_t target = remap[index];
+
+		if (target == noParent)
+			continue;
+
+		nodes[target] = m_nodes[index];
+		parents[target] = m_parents[index] == noParent ? noParent : remap[m_parents[index]];
+		depths[target] = m_depths[index];
+		dirty[target] = m_dirty[index];
+		local[target] = m_local[index];
+		global[target] = m_global[index];
+		normal[target] = m_normal[index];
+
+		nodes[target]->m_hierarchyIndex = target;
+
+		if (dirty[target] && target < firstDirty)
+			firstDirty = target;
+	}
+
+	m_nodes.swap(nodes);
+	m_parents.swap(parents);
+	m_depths.swap(depths);
+	m_dirty.swap(dirty);
+	m_local.swap(local);
+	m_global.swap(global);
+	m_normal.swap(normal);
+
+	m_firstDirty = firstDirty;
+	m_needsRebuild = false;
+}
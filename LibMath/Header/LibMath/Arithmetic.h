@@ -1,26 +1,30 @@
 #ifndef __LIBMATH__ARITHMETIC_H__
 #define __LIBMATH__ARITHMETIC_H__
 
+#include <cmath>
+
 namespace LibMath
 {
-	bool			almostEqual(float, float);		// Return if two floating value are similar enought to be considered equal
+	constexpr bool		almostEqual(float, float);		// Return if two floating value are similar enought to be considered equal
 
-	float			ceiling(float);				// Return lowest integer value higher or equal to parameter
-	float			clamp(float, float, float);	// Return parameter limited by the given range
-	float			floor(float);					// Return highest integer value lower or equal to parameter
-	float			squareRoot(float);			// Return square root of parameter
-	float			wrap(float, float, float);	// Return parameter as value inside the given range
-	float			power(float, unsigned int);
+	float				ceiling(float);				// Return lowest integer value higher or equal to parameter
+	constexpr float		clamp(float, float, float);	// Return parameter limited by the given range
+	float				floor(float);					// Return highest integer value lower or equal to parameter
+	inline float		squareRoot(float);			// Return square root of parameter
+	float				wrap(float, float, float);	// Return parameter as value inside the given range
+	float				power(float, unsigned int);
 
-	unsigned int	factorial(unsigned int);
+	unsigned int		factorial(unsigned int);
 
-	float			absolute(float);
-	int				absolute(int);
+	constexpr float		absolute(float);
+	constexpr int		absolute(int);
 
-	float			min(float, float);
-	float			max(float, float);
+	constexpr float		min(float, float);
+	constexpr float		max(float, float);
 }
 
+#include "Arithmetic.inl"
+
 namespace lm = LibMath;
 
 #endif // !__LIBMATH__ARITHMETIC_H__
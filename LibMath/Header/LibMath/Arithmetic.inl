@@ -0,0 +1,49 @@
+#ifndef __LIBMATH__ARITHMETIC_INL__
+#define __LIBMATH__ARITHMETIC_INL__
+
+namespace LibMath
+{
+	inline float squareRoot(float square)
+	{
+		return sqrtf(square);
+	}
+
+	constexpr float absolute(float num)
+	{
+		return (num >= 0.F) ? num : -num;
+	}
+
+	constexpr int absolute(int num)
+	{
+		return (num >= 0) ? num : -num;
+	}
+
+	constexpr bool almostEqual(float left, float right)
+	{
+		const float precision = 0.001F;
+
+		return absolute(left - right) < precision;
+	}
+
+	constexpr float min(float a, float b)
+	{
+		return (a < b) ? a : b;
+	}
+
+	constexpr float max(float a, float b)
+	{
+		return (a > b) ? a : b;
+	}
+
+	constexpr float clamp(float val, float low, float high)
+	{
+		if (val < low)
+			return low;
+		else if (val > high)
+			return high;
+
+		return val;
+	}
+}
+
+#endif // !__LIBMATH__ARITHMETIC_INL__
@@ -0,0 +1,49 @@
+#ifndef __LIBMATH__BATCH_H__
+#define __LIBMATH__BATCH_H__
+
+#include <cstddef>
+#include <span>
+
+#include "Matrix/Matrix4.h"
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+	// Structure of arrays view over 3D vectors, one span per component
+	struct Vector3Span
+	{
+		std::span<float>		m_x;
+		std::span<float>		m_y;
+		std::span<float>		m_z;
+
+		size_t					size() const;						// return the smallest component count
+	};
+
+	// Read only structure of arrays view, a Vector3Span converts implicitly
+	struct ConstVector3Span
+	{
+								ConstVector3Span(std::span<const float>, std::span<const float>, std::span<const float>);
+								ConstVector3Span(Vector3Span const&);
+
+		std::span<const float>	m_x;
+		std::span<const float>	m_y;
+		std::span<const float>	m_z;
+
+		size_t					size() const;						// return the smallest component count
+	};
+
+	// Batch kernels, row vector convention (v * matrix) like the Matrix classes
+	// Only min(input, output) elements are written, output may alias input
+
+	void	transformPoints(Matrix4 const&, ConstVector3Span, Vector3Span);				// transform positions, w = 1
+	void	transformDirections(Matrix4 const&, ConstVector3Span, Vector3Span);			// transform directions, w = 0 so translation is ignored
+	void	transformAABBs(Matrix4 const&, ConstVector3Span centers, ConstVector3Span extents,
+						   Vector3Span outCenters, Vector3Span outExtents);				// return the axis aligned box enclosing each transformed box
+
+	void	transformAABB(Matrix4 const&, Vector3 const& center, Vector3 const& extents,
+						  Vector3& outCenter, Vector3& outExtents);						// single box version of transformAABBs
+}
+
+namespace lm = LibMath;
+
+#endif // !__LIBMATH__BATCH_H__
@@ -0,0 +1,47 @@
+#ifndef __LIBMATH__FAST_MATH_H__
+#define __LIBMATH__FAST_MATH_H__
+
+#include "Angle/Radian.h"
+#include "Vector/Vector3.h"
+
+/*
+	Approximate versions of the LibMath functions, picked per call site:
+	LibMath::sin(angle) stays exact (std wrapper), LibMath::Fast::sin(angle) trades
+	a few ULP for throughput. Only use them where the result is not accumulated
+	or compared for exact equality (camera vectors, collision response...)
+
+	Measured max error against a double precision reference (FastMathBench):
+
+	function				range					max error
+	sin, cos				[-pi, pi]				1.5 ULP, 7.7e-8 absolute
+	sin, cos				[-8192, 8192]			7.7e-8 absolute (43 ULP next to the zeros)
+	tan						[-1.5, 1.5]				2.4 ULP
+	atan					[-1e4, 1e4]				2.5 ULP
+	inverseSquareRoot		[1e-30, 1e30]			3.8 ULP with SSE, 1.5 ULP without
+	normalizedCopy			|v| in [1e-15, 1e15]	4.4 ULP per component with SSE, 2.8 ULP without
+
+	Trig inputs outside [-8192, 8192] lose accuracy (no large argument reduction)
+*/
+
+namespace LibMath::Fast
+{
+	inline float		sin(float);								// radians, polynomial on [-pi/4, pi/4] after reduction
+	inline float		cos(float);								// radians, polynomial on [-pi/4, pi/4] after reduction
+	inline void			sinCos(float, float& sine, float& cosine);	// both for the price of one reduction
+	inline float		tan(float);								// radians
+	inline float		atan(float);							// return radians in [-pi/2, pi/2]
+
+	inline float		sin(Radian);
+	inline float		cos(Radian);
+	inline float		tan(Radian);
+
+	inline float		inverseSquareRoot(float);				// return 1 / sqrt(x), hardware estimate & one Newton step (exact without SSE)
+	inline void			normalize(Vector3&);					// scale to a magnitude of 1, zero vectors become NaN like Vector3::normalize
+	inline Vector3		normalizedCopy(Vector3 const&);			// return a copy with a magnitude of 1
+}
+
+#include "FastMath.inl"
+
+namespace lm = LibMath;
+
+#endif // !__LIBMATH__FAST_MATH_H__
@@ -0,0 +1,196 @@
+#ifndef __LIBMATH__FAST_MATH_INL__
+#define __LIBMATH__FAST_MATH_INL__
+
+#include <bit>
+#include <cstdint>
+
+#include "Arithmetic.h"
+#include "Simd.h"
+
+namespace LibMath::Fast
+{
+	/*
+		Cephes style reduction: x = j * pi/4 + r with |r| <= pi/4, pi/4 split in
+		three floats so r keeps full precision for |x| up to 8192. The octant j
+		picks the sine or cosine polynomial & the sign
+	*/
+
+	constexpr float	g_fourOverPi = 1.27323954473516f;
+	constexpr float	g_quarterPi1 = 0.78515625f;
+	constexpr float	g_quarterPi2 = 2.4187564849853515625e-4f;
+	constexpr float	g_quarterPi3 = 3.77489497744594108e-8f;
+
+	// Return |x| reduced to [-pi/4, pi/4], octant is in [0, 7]
+	inline float reduceQuarterPi(float absolute, int& octant)
+	{
+		octant = static_cast<int>(absolute * g_fourOverPi);
+
+		// Round to an even octant so the remainder is centered
+		octant += octant & 1;
+
+		const float multiple = static_cast<float>(octant);
+
+		octant &= 7;
+
+		return ((absolute - multiple * g_quarterPi1) - multiple * g_quarterPi2) - multiple * g_quarterPi3;
+	}
+
+	inline float sinPolynomial(float x, float x2)
+	{
+		return ((-1.9515295891e-4f * x2 + 8.3321608736e-3f) * x2 - 1.6666654611e-1f) * x2 * x + x;
+	}
+
+	inline float cosPolynomial(float x2)
+	{
+		return ((2.443315711809948e-5f * x2 - 1.388731625493765e-3f) * x2 + 4.166664568298827e-2f) * x2 * x2 - 0.5f * x2 + 1.f;
+	}
+
+	/*
+		The octant is unpredictable, so the polynomial & the sign are picked with
+		bit masks instead of branches
+	*/
+
+	// Return second if pick is 1, first if pick is 0
+	inline float select(float first, float second, uint32_t pick)
+	{
+		const uint32_t mask = 0u - pick;
+
+		return std::bit_cast<float>((std::bit_cast<uint32_t>(first) & ~mask) | (std::bit_cast<uint32_t>(second) & mask));
+	}
+
+	// Flip the sign of value if negate is 1
+	inline float negateIf(float value, uint32_t negate)
+	{
+		return std::bit_cast<float>(std::bit_cast<uint32_t>(value) ^ (negate << 31));
+	}
+
+	// Octants 1, 2, 5 & 6 swap the polynomials
+	inline uint32_t swapsPolynomials(int octant)
+	{
+		return ((octant + 1) >> 1) & 1;
+	}
+
+	// sin is odd & negative in octants 4 to 7
+	inline uint32_t sineIsNegative(float angle, int octant)
+	{
+		return (octant >> 2) ^ (angle < 0.f);
+	}
+
+	// cos is even & negative in octants 2 to 5
+	inline uint32_t cosineIsNegative(int octant)
+	{
+		return ((octant + 2) >> 2) & 1;
+	}
+
+	/*
+		sin & cos compute their own result rather than going through sinCos, the
+		extra outputs make sinCos too big for the compiler to inline everywhere
+	*/
+
+	inline float sin(float angle)
+	{
+		int			octant;
+		const float	x = reduceQuarterPi(angle < 0.f ? -angle : angle, octant);
+		const float	x2 = x * x;
+
+		return negateIf(select(sinPolynomial(x, x2), cosPolynomial(x2), swapsPolynomials(octant)), sineIsNegative(angle, octant));
+	}
+
+	inline float cos(float angle)
+	{
+		int			octant;
+		const float	x = reduceQuarterPi(angle < 0.f ? -angle : angle, octant);
+		const float	x2 = x * x;
+
+		return negateIf(select(cosPolynomial(x2), sinPolynomial(x, x2), swapsPolynomials(octant)), cosineIsNegative(octant));
+	}
+
+	inline void sinCos(float angle, float& sine, float& cosine)
+	{
+		int				octant;
+		const float		x = reduceQuarterPi(angle < 0.f ? -angle : angle, octant);
+		const float		x2 = x * x;
+
+		const float		sinPart = sinPolynomial(x, x2);
+		const float		cosPart = cosPolynomial(x2);
+		const uint32_t	swap = swapsPolynomials(octant);
+
+		sine = negateIf(select(sinPart, cosPart, swap), sineIsNegative(angle, octant));
+		cosine = negateIf(select(cosPart, sinPart, swap), cosineIsNegative(octant));
+	}
+
+	inline float tan(float angle)
+	{
+		int			octant;
+		const float	x = reduceQuarterPi(angle < 0.f ? -angle : angle, octant);
+		const float	x2 = x * x;
+
+		float		tangent = (((((9.38540185543e-3f * x2 + 3.11992232697e-3f) * x2 + 2.44301354525e-2f) * x2
+							  + 5.34112807005e-2f) * x2 + 1.33387994085e-1f) * x2 + 3.33331568548e-1f) * x2 * x + x;
+
+		// tan(x + pi/2) = -1 / tan(x)
+		tangent = select(tangent, -1.f / tangent, (octant >> 1) & 1);
+
+		return negateIf(tangent, angle < 0.f);
+	}
+
+	inline float atan(float tangent)
+	{
+		const float		absolute = tangent < 0.f ? -tangent : tangent;
+		const uint32_t	large = absolute > 2.414213562373095f;
+		const uint32_t	medium = absolute > 0.4142135623730950f;
+
+		// Bring the argument to [-tan(pi/8), tan(pi/8)], atan(x) = pi/4 + atan((x - 1) / (x + 1)) = pi/2 + atan(-1 / x)
+		float			x = select(absolute, (absolute - 1.f) / (absolute + 1.f), medium);
+		float			offset = select(0.f, 0.7853981633974483f, medium);
+
+		x = select(x, -1.f / absolute, large);
+		offset = select(offset, 1.5707963267948966f, large);
+
+		const float x2 = x * x;
+		const float result = offset + (((8.05374449538e-2f * x2 - 1.38776856032e-1f) * x2 + 1.99777106478e-1f) * x2
+									   - 3.33329491539e-1f) * x2 * x + x;
+
+		return negateIf(result, tangent < 0.f);
+	}
+
+	inline float sin(Radian angle)
+	{
+		return sin(angle.raw());
+	}
+
+	inline float cos(Radian angle)
+	{
+		return cos(angle.raw());
+	}
+
+	inline float tan(Radian angle)
+	{
+		return tan(angle.raw());
+	}
+
+	inline float inverseSquareRoot(float value)
+	{
+#if defined(LIBMATH_SSE)
+		// 12 bit hardware estimate, one Newton-Raphson step doubles the correct bits
+		const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+
+		return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#else
+		// No estimate instruction, square root is still a single hardware instruction
+		return 1.f / squareRoot(value);
+#endif
+	}
+
+	inline void normalize(Vector3& vector)
+	{
+		vector = vector * inverseSquareRoot(vector.magnitudeSquared());
+	}
+
+	inline Vector3 normalizedCopy(Vector3 const& vector)
+	{
+		return vector * inverseSquareRoot(vector.magnitudeSquared());
+	}
+}
+
+#endif // !__LIBMATH__FAST_MATH_INL__
@@ -1,8 +1,50 @@
 #ifndef __LIBMATH__INTERSECTION_H__
 #define __LIBMATH__INTERSECTION_H__
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Batch.h"
+#include "Vector/Vector3.h"
+#include "Vector/Vector4.h"
+
 namespace LibMath
 {
+	// Structure of arrays view over axis aligned boxes stored as min & max corners
+	struct ConstAABBSpan
+	{
+		ConstVector3Span		m_min;
+		ConstVector3Span		m_max;
+
+		size_t					size() const;						// return the smallest component count
+	};
+
+	// Index returned by the nearest hit queries when nothing is hit
+	constexpr size_t			noHit = static_cast<size_t>(-1);
+
+	// Number of 64 bit words needed to hold a hit mask of count elements
+	constexpr size_t			hitMaskSize(size_t count) { return (count + 63) / 64; }
+
+	// Batch kernels, one query against N primitives
+	// Rays take 1 / direction, infinite components are fine for axis aligned rays
+	// Bit i of the mask (word i / 64, bit i % 64) is set if primitive i is hit
+	// Only min(primitives, 64 * mask words) elements are tested, each returns the number of hits
+
+	size_t	intersectRayAABBs(Vector3 const& origin, Vector3 const& inverseDirection, ConstAABBSpan boxes,
+							  std::span<uint64_t> hits);							// slab test, hit if the ray exits a box in front of its origin
+	size_t	nearestRayAABB(Vector3 const& origin, Vector3 const& inverseDirection, ConstAABBSpan boxes,
+						   float& distance);										// return the index of the closest hit box or noHit, distance is the entry distance
+	size_t	intersectSphereAABBs(Vector3 const& center, float radius, ConstAABBSpan boxes,
+								 std::span<uint64_t> hits);						// hit if the closest point of a box is strictly inside the sphere
+	size_t	intersectAABBAABBs(Vector3 const& min, Vector3 const& max, ConstAABBSpan boxes,
+							   std::span<uint64_t> hits);							// hit if the boxes overlap or touch
+	size_t	intersectFrustumAABBs(std::span<const Vector4, 6> planes, ConstVector3Span centers, ConstVector3Span extents,
+								  std::span<uint64_t> hits);						// hit if a box is not fully behind any of the 6 planes, planes are normal (xyz) & distance (w)
+	size_t	cullFrustumAABBs(std::span<const Vector4, 6> planes, ConstVector3Span centers, ConstVector3Span extents,
+							 std::span<uint8_t> lastPlanes, std::span<uint64_t> hits);	// same hits as intersectFrustumAABBs, lastPlanes keeps the plane that rejected each box, tested first when a lane group shares it
 }
 
+namespace lm = LibMath;
+
 #endif // !__LIBMATH__INTERSECTION_H__
@@ -0,0 +1,195 @@
+#ifndef __LIBMATH__MATRIX__MATRIX3_INL__
+#define __LIBMATH__MATRIX__MATRIX3_INL__
+
+#include <float.h>
+
+#include "../Arithmetic.h"
+
+namespace LibMath
+{
+	// Constructor to create a 3x3 identity matrix
+	constexpr Matrix3::Matrix3()
+	{
+		// Initialize as identity matrix
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				this->m_matrix[i][j] = (i == j ? 1.0f : 0.0f);
+			}
+		}
+	}
+
+	// Constructor to create a 3x3 identity matrix multiplied by a scalar
+	constexpr Matrix3::Matrix3(float scalar)
+	{
+		// Initialize as identity matrix multiplied by a scalar
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
+			}
+		}
+	}
+
+	constexpr Matrix3::Matrix3(float* arr)
+	{
+		for (int i = 0; i < 9; i++)
+		{
+			this->m_matrix[i / 3][i % 3] = arr[i];
+		}
+	}
+
+	constexpr Matrix3 Matrix3::Transpose(const Matrix3& matrix)
+	{
+		LibMath::Matrix3 matrix3 = matrix;
+
+		// Transpose matrix
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				this->m_matrix[j][i] = matrix3.m_matrix[i][j];
+			}
+		}
+
+		return *this;
+	}
+
+	constexpr Matrix3 Matrix3::Identity(float scalar)
+	{
+		// Create an identity matrix and multiply by scalar
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
+			}
+		}
+
+		return *this;
+	}
+
+	constexpr float Matrix3::Determinant(const Matrix3& matrix)
+	{
+		/*
+			Split 3x3 matrix into 3 2x2 matrix and multiply by the coefficient
+
+			Equation:
+			|a b c|
+			|d e f|
+			|g h i|
+
+			Determinant = a(ei - fh) - b(di - gf) + c(dh - eg)
+		*/
+		float a = matrix.m_matrix[0][0] * ((matrix.m_matrix[1][1] * matrix.m_matrix[2][2]) - (matrix.m_matrix[1][2] * matrix.m_matrix[2][1]));
+		float b = matrix.m_matrix[0][1] * ((matrix.m_matrix[1][0] * matrix.m_matrix[2][2]) - (matrix.m_matrix[1][2] * matrix.m_matrix[2][0]));
+		float c = matrix.m_matrix[0][2] * ((matrix.m_matrix[1][0] * matrix.m_matrix[2][1]) - (matrix.m_matrix[1][1] * matrix.m_matrix[2][0]));
+
+		return a - b + c;
+	}
+
+	constexpr Matrix3 Matrix3::operator+(const Matrix3 matrixB) const
+	{
+		Matrix3 tmp;
+
+		for (int i = 0; i < 9; ++i)
+		{
+			tmp.m_matrix[i / 3][i % 3] = this->m_matrix[i / 3][i % 3] + matrixB.m_matrix[i / 3][i % 3];
+		}
+
+		return tmp;
+	}
+
+	constexpr Matrix3 Matrix3::operator-(const Matrix3 matrixB) const
+	{
+		Matrix3 tmp;
+
+		for (int i = 0; i < 9; ++i)
+		{
+			tmp.m_matrix[i / 3][i % 3] = this->m_matrix[i / 3][i % 3] - matrixB.m_matrix[i / 3][i % 3];
+		}
+
+		return tmp;
+	}
+
+	constexpr Matrix3 Matrix3::operator*(const Matrix3 matrixB) const
+	{
+		Matrix3 result;
+
+		// Iterate through matrix to set the result matrix equal to the result of the 2 matrices multiplied
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				result.m_matrix[i][j] = 0.0f;
+
+				for (int k = 0; k < 3; k++)
+				{
+					// Add the value obtained from multiplying the 2 matrices row * column
+					result.m_matrix[i][j] += this->m_matrix[i][k] * matrixB.m_matrix[k][j];
+				}
+			}
+		}
+
+		return result;
+	}
+
+	constexpr Matrix3 Matrix3::operator*(const float num) const
+	{
+		Matrix3 tmp;
+
+		for (int i = 0; i < 9; ++i)
+		{
+			tmp.m_matrix[i / 3][i % 3] = m_matrix[i / 3][i % 3] * num;
+		}
+
+		return tmp;
+	}
+
+	constexpr Matrix3& Matrix3::operator+=(const Matrix3 matrixB)
+	{
+		return *this = *this + matrixB;
+	}
+
+	constexpr Matrix3& Matrix3::operator-=(const Matrix3 matrixB)
+	{
+		return *this = *this - matrixB;
+	}
+
+	constexpr Matrix3& Matrix3::operator*=(const Matrix3 matrixB)
+	{
+		return *this = *this * matrixB;
+	}
+
+	constexpr Matrix3& Matrix3::operator*=(const float& num)
+	{
+		return *this = *this * num;
+	}
+
+	constexpr bool Matrix3::operator==(const Matrix3 matrixB) const
+	{
+		// Check equality via epsilon test
+		for (int i = 0; i < 9; ++i)
+		{
+			float num1 = LibMath::absolute(m_matrix[i / 3][i % 3]);
+			float num2 = LibMath::absolute(matrixB.m_matrix[i / 3][i % 3]);
+
+			float difference = LibMath::absolute(m_matrix[i / 3][i % 3] - matrixB.m_matrix[i / 3][i % 3]);
+			float scaledEpsilon = FLT_EPSILON * LibMath::max(num1, num2);
+
+			if (difference > scaledEpsilon)
+				return false;
+		}
+
+		return true;
+	}
+
+	constexpr bool Matrix3::operator!=(const Matrix3 matrixB) const
+	{
+		return !(*this == matrixB);
+	}
+}
+
+#endif // !__LIBMATH__MATRIX__MATRIX3_INL__
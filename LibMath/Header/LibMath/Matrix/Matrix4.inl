@@ -0,0 +1,243 @@
+#ifndef __LIBMATH__MATRIX__MATRIX4_INL__
+#define __LIBMATH__MATRIX__MATRIX4_INL__
+
+#include <float.h>
+#include <type_traits>
+
+#include "../Arithmetic.h"
+
+namespace LibMath
+{
+	constexpr Matrix4::Matrix4()
+	{
+		// Initialize as identity matrix
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				this->m_matrix[i][j] = (i == j ? 1.0f : 0.0f);
+			}
+		}
+	}
+
+	constexpr Matrix4::Matrix4(float scalar)
+	{
+		// Initialize as identity matrix multiplied by a scalar
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
+			}
+		}
+	}
+
+	constexpr Matrix4::Matrix4(float arr[4][4])
+	{
+		for (int i = 0; i < 16; ++i)
+		{
+			this->m_matrix[i / 4][i % 4] = arr[i / 4][i % 4];
+		}
+	}
+
+	constexpr Matrix4 Matrix4::Identity(float scalar)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
+			}
+		}
+
+		return *this;
+	}
+
+	constexpr Matrix4 Matrix4::Transpose(const Matrix4& matrix)
+	{
+#if defined(LIBMATH_SSE)
+		if (!std::is_constant_evaluated())
+		{
+			__m128 row0 = _mm_loadu_ps(matrix.m_matrix[0]);
+			__m128 row1 = _mm_loadu_ps(matrix.m_matrix[1]);
+			__m128 row2 = _mm_loadu_ps(matrix.m_matrix[2]);
+			__m128 row3 = _mm_loadu_ps(matrix.m_matrix[3]);
+
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+			LibMath::Matrix4 result;
+
+			_mm_storeu_ps(result.m_matrix[0], row0);
+			_mm_storeu_ps(result.m_matrix[1], row1);
+			_mm_storeu_ps(result.m_matrix[2], row2);
+			_mm_storeu_ps(result.m_matrix[3], row3);
+
+			return *this = result;
+		}
+#endif
+
+		LibMath::Matrix4 matrix4 = matrix;
+
+		// Transpose matrix
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				this->m_matrix[j][i] = matrix4.m_matrix[i][j];
+			}
+		}
+
+		return *this;
+	}
+
+	constexpr Matrix4 Matrix4::operator+(const Matrix4& matrixB) const
+	{
+		LibMath::Matrix4 result;
+
+		for (int i = 0; i < 16; ++i)
+		{
+			result.m_matrix[i / 4][i % 4] = this->m_matrix[i / 4][i % 4] + matrixB.m_matrix[i / 4][i % 4];
+		}
+
+		return result;
+	}
+
+	constexpr Matrix4 Matrix4::operator-(const Matrix4& matrixB) const
+	{
+		LibMath::Matrix4 result;
+
+		for (int i = 0; i < 16; ++i)
+		{
+			result.m_matrix[i / 4][i % 4] = this->m_matrix[i / 4][i % 4] - matrixB.m_matrix[i / 4][i % 4];
+		}
+
+		return result;
+	}
+
+	constexpr Matrix4 Matrix4::operator*(const Matrix4& matrixB) const
+	{
+		LibMath::Matrix4 result;
+
+#if defined(LIBMATH_AVX)
+		if (!std::is_constant_evaluated())
+		{
+			// Each result row is a linear combination of matrixB rows, two rows per iteration
+			__m256 rowB0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrixB.m_matrix[0]));
+			__m256 rowB1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrixB.m_matrix[1]));
+			__m256 rowB2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrixB.m_matrix[2]));
+			__m256 rowB3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrixB.m_matrix[3]));
+
+			for (int i = 0; i < 4; i += 2)
+			{
+				__m256 rowsA = _mm256_loadu_ps(this->m_matrix[i]);
+
+				__m256 rows = _mm256_mul_ps(_mm256_shuffle_ps(rowsA, rowsA, 0x00), rowB0);
+				rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(rowsA, rowsA, 0x55), rowB1));
+				rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(rowsA, rowsA, 0xAA), rowB2));
+				rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(rowsA, rowsA, 0xFF), rowB3));
+
+				_mm256_storeu_ps(result.m_matrix[i], rows);
+			}
+
+			return result;
+		}
+#elif defined(LIBMATH_SSE)
+		if (!std::is_constant_evaluated())
+		{
+			// Each result row is a linear combination of matrixB rows
+			__m128 rowB0 = _mm_loadu_ps(matrixB.m_matrix[0]);
+			__m128 rowB1 = _mm_loadu_ps(matrixB.m_matrix[1]);
+			__m128 rowB2 = _mm_loadu_ps(matrixB.m_matrix[2]);
+			__m128 rowB3 = _mm_loadu_ps(matrixB.m_matrix[3]);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				__m128 rowA = _mm_loadu_ps(this->m_matrix[i]);
+
+				__m128 row = _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(0, 0, 0, 0)), rowB0);
+				row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(1, 1, 1, 1)), rowB1));
+				row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(2, 2, 2, 2)), rowB2));
+				row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(3, 3, 3, 3)), rowB3));
+
+				_mm_storeu_ps(result.m_matrix[i], row);
+			}
+
+			return result;
+		}
+#endif
+
+		// Iterate through matrix to set the result matrix equal to the result of the 2 matrices multiplied
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				result.m_matrix[i][j] = 0.0f;
+
+				for (int k = 0; k < 4; ++k)
+				{
+					// Add the value obtained from multiplying the 2 matrices row * column
+					result.m_matrix[i][j] += this->m_matrix[i][k] * matrixB.m_matrix[k][j];
+				}
+			}
+		}
+
+		return result;
+	}
+
+	constexpr Matrix4 Matrix4::operator*(const float& num) const
+	{
+		LibMath::Matrix4 tmp;
+
+		for (int i = 0; i < 16; ++i)
+		{
+			tmp.m_matrix[i / 4][i % 4] = m_matrix[i / 4][i % 4] * num;
+		}
+
+		return tmp;
+	}
+
+	constexpr Matrix4& Matrix4::operator+=(const Matrix4 matrixB)
+	{
+		return *this = *this + matrixB;
+	}
+
+	constexpr Matrix4& Matrix4::operator-=(const Matrix4 matrixB)
+	{
+		return *this = *this - matrixB;
+	}
+
+	constexpr Matrix4& Matrix4::operator*=(const Matrix4 matrixB)
+	{
+		return *this = *this * matrixB;
+	}
+
+	constexpr Matrix4& Matrix4::operator*=(const float& num)
+	{
+		return *this = *this * num;
+	}
+
+	constexpr bool Matrix4::operator==(const Matrix4 matrixB) const
+	{
+		// Check equality via epsilon test
+		for (int i = 0; i < 16; ++i)
+		{
+			float num1 = LibMath::absolute(m_matrix[i / 4][i % 4]);
+			float num2 = LibMath::absolute(matrixB.m_matrix[i / 4][i % 4]);
+
+			float difference = LibMath::absolute(m_matrix[i / 4][i % 4] - matrixB.m_matrix[i / 4][i % 4]);
+			float scaledEpsilon = FLT_EPSILON * LibMath::max(num1, num2);
+
+			if (difference > scaledEpsilon)
+				return false;
+		}
+
+		return true;
+	}
+
+	constexpr bool Matrix4::operator!=(const Matrix4 matrixB) const
+	{
+		return !(*this == matrixB);
+	}
+}
+
+#endif // !__LIBMATH__MATRIX__MATRIX4_INL__
@@ -1,8 +1,77 @@
 #ifndef __LIBMATH__QUATERNION_H__
 #define __LIBMATH__QUATERNION_H__
 
+#include <iostream>
+#include <string>
+
+#include "Angle/Radian.h"
+#include "Vector/Vector3.h"
+#include "Matrix/Matrix3.h"
+#include "Matrix/Matrix4.h"
+
 namespace LibMath
 {
+	// Rotation stored as x i + y j + z k + w
+	class Quaternion
+	{
+	public:
+		constexpr				Quaternion();										// identity rotation
+		constexpr				Quaternion(float, float, float, float);				// set all component individually (x, y, z, w)
+		constexpr				Quaternion(Vector3 const&, float);					// set vector part & scalar part
+								Quaternion(Radian, Vector3 const&);					// rotation of a given angle around an arbitrary axis
+		constexpr				Quaternion(Quaternion const&) = default;
+		constexpr				~Quaternion() = default;
+
+		static constexpr Quaternion	identity();										// return a quaternion with no rotation
+
+		constexpr Quaternion&	operator=(Quaternion const&) = default;
+
+		constexpr Quaternion	conjugate() const;								// return a copy with the vector part inverted
+		constexpr Quaternion	inverse() const;								// return the inverse rotation, conjugate divided by the squared magnitude
+
+		constexpr float			dot(Quaternion const&) const;					// return dot product result
+
+		inline float			magnitude() const;								// return quaternion magnitude
+		constexpr float			magnitudeSquared() const;						// return square value of the quaternion magnitude
+
+		inline void				normalize();									// scale this quaternion to have a magnitude of 1
+		inline Quaternion		normalizedCopy() const;							// get a copy of this quaternion with a magnitude of 1
+
+		constexpr Vector3		rotate(Vector3 const&) const;					// return a copy of a vector rotated by this unit quaternion
+
+		constexpr Matrix3		toMatrix3() const;								// return the rotation matrix of this unit quaternion, row vector convention
+		constexpr Matrix4		toMatrix4() const;								// return the rotation matrix of this unit quaternion, row vector convention
+
+		std::string				string() const;									// return a string representation of this quaternion
+
+		float m_x = 0.F;
+		float m_y = 0.F;
+		float m_z = 0.F;
+		float m_w = 1.F;
+	};
+
+	constexpr bool			operator==(Quaternion const&, Quaternion const&);	// return if 2 quaternions have the same component
+	constexpr bool			operator!=(Quaternion const&, Quaternion const&);	// return if 2 quaternions differ by at least a component
+
+	constexpr Quaternion	operator-(Quaternion const&);						// negate all component, same rotation
+
+	constexpr Quaternion	operator+(Quaternion const&, Quaternion const&);	// add 2 quaternions component wise
+	constexpr Quaternion	operator-(Quaternion const&, Quaternion const&);	// substract 2 quaternions component wise
+	constexpr Quaternion	operator*(Quaternion const&, Quaternion const&);	// hamilton product, a * b rotates by b then a
+	constexpr Quaternion	operator*(Quaternion const&, float);				// multiply all component by a same number
+	constexpr Quaternion	operator*(float, Quaternion const&);
+
+	constexpr Quaternion&	operator*=(Quaternion&, Quaternion const&);			// hamilton product
+	constexpr Quaternion&	operator*=(Quaternion&, float);						// multiply all component by a same number
+
+	Quaternion				nlerp(Quaternion const&, Quaternion const&, float);	// normalized linear interpolation along the shortest path
+	Quaternion				slerp(Quaternion const&, Quaternion const&, float);	// spherical linear interpolation along the shortest path
+
+	std::ostream&			operator<<(std::ostream&, Quaternion const&);		// add a quaternion string representation to an output stream
 }
 
+#include "Quaternion.inl"
+
+namespace lm = LibMath;
+
 #endif // !__LIBMATH__QUATERNION_H__
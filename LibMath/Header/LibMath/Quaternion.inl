@@ -0,0 +1,172 @@
+#ifndef __LIBMATH__QUATERNION_INL__
+#define __LIBMATH__QUATERNION_INL__
+
+#include "Arithmetic.h"
+
+namespace LibMath
+{
+	constexpr Quaternion::Quaternion() {}
+
+	constexpr Quaternion::Quaternion(float x, float y, float z, float w)
+		: m_x(x), m_y(y), m_z(z), m_w(w) {}
+
+	constexpr Quaternion::Quaternion(Vector3 const& vector, float w)
+		: m_x(vector.m_x), m_y(vector.m_y), m_z(vector.m_z), m_w(w) {}
+
+	constexpr Quaternion Quaternion::identity()
+	{
+		return Quaternion(0.F, 0.F, 0.F, 1.F);
+	}
+
+	constexpr Quaternion Quaternion::conjugate() const
+	{
+		return Quaternion(-m_x, -m_y, -m_z, m_w);
+	}
+
+	constexpr Quaternion Quaternion::inverse() const
+	{
+		float lengthSquared = magnitudeSquared();
+
+		// Degenerate quaternion, no rotation to invert
+		if (lengthSquared == 0.F)
+			return identity();
+
+		return conjugate() * (1.F / lengthSquared);
+	}
+
+	constexpr float Quaternion::dot(Quaternion const& other) const
+	{
+		return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z + m_w * other.m_w;
+	}
+
+	inline float Quaternion::magnitude() const
+	{
+		return squareRoot(magnitudeSquared());
+	}
+
+	constexpr float Quaternion::magnitudeSquared() const
+	{
+		return dot(*this);
+	}
+
+	inline void Quaternion::normalize()
+	{
+		float length = magnitude();
+
+		if (length == 0.F)
+		{
+			*this = identity();
+			return;
+		}
+
+		*this *= 1.F / length;
+	}
+
+	inline Quaternion Quaternion::normalizedCopy() const
+	{
+		Quaternion copy = *this;
+
+		copy.normalize();
+
+		return copy;
+	}
+
+	constexpr Vector3 Quaternion::rotate(Vector3 const& vector) const
+	{
+		// v' = v + 2w (u x v) + 2 u x (u x v), with u the vector part
+		Vector3 axis(m_x, m_y, m_z);
+		Vector3 twiceCross = axis.cross(vector) * 2.F;
+
+		return vector + twiceCross * m_w + axis.cross(twiceCross);
+	}
+
+	constexpr Matrix3 Quaternion::toMatrix3() const
+	{
+		float xx = m_x * m_x, yy = m_y * m_y, zz = m_z * m_z;
+		float xy = m_x * m_y, xz = m_x * m_z, yz = m_y * m_z;
+		float wx = m_w * m_x, wy = m_w * m_y, wz = m_w * m_z;
+
+		// Transposed compared to the column vector form, same as Matrix3 rotations
+		float values[9] =
+		{
+			1.F - 2.F * (yy + zz),	2.F * (xy + wz),		2.F * (xz - wy),
+			2.F * (xy - wz),		1.F - 2.F * (xx + zz),	2.F * (yz + wx),
+			2.F * (xz + wy),		2.F * (yz - wx),		1.F - 2.F * (xx + yy)
+		};
+
+		return Matrix3(values);
+	}
+
+	constexpr Matrix4 Quaternion::toMatrix4() const
+	{
+		Matrix3 rotation = toMatrix3();
+		Matrix4 result;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+				result.m_matrix[i][j] = rotation.m_matrix[i][j];
+		}
+
+		return result;
+	}
+
+	constexpr bool operator==(Quaternion const& left, Quaternion const& right)
+	{
+		return almostEqual(left.m_x, right.m_x) && almostEqual(left.m_y, right.m_y) &&
+			   almostEqual(left.m_z, right.m_z) && almostEqual(left.m_w, right.m_w);
+	}
+
+	constexpr bool operator!=(Quaternion const& left, Quaternion const& right)
+	{
+		return !(left == right);
+	}
+
+	constexpr Quaternion operator-(Quaternion const& quaternion)
+	{
+		return Quaternion(-quaternion.m_x, -quaternion.m_y, -quaternion.m_z, -quaternion.m_w);
+	}
+
+	constexpr Quaternion operator+(Quaternion const& left, Quaternion const& right)
+	{
+		return Quaternion(left.m_x + right.m_x, left.m_y + right.m_y, left.m_z + right.m_z, left.m_w + right.m_w);
+	}
+
+	constexpr Quaternion operator-(Quaternion const& left, Quaternion const& right)
+	{
+		return Quaternion(left.m_x - right.m_x, left.m_y - right.m_y, left.m_z - right.m_z, left.m_w - right.m_w);
+	}
+
+	constexpr Quaternion operator*(Quaternion const& left, Quaternion const& right)
+	{
+		return Quaternion
+		(
+			left.m_w * right.m_x + left.m_x * right.m_w + left.m_y * right.m_z - left.m_z * right.m_y,
+			left.m_w * right.m_y - left.m_x * right.m_z + left.m_y * right.m_w + left.m_z * right.m_x,
+			left.m_w * right.m_z + left.m_x * right.m_y - left.m_y * right.m_x + left.m_z * right.m_w,
+			left.m_w * right.m_w - left.m_x * right.m_x - left.m_y * right.m_y - left.m_z * right.m_z
+		);
+	}
+
+	constexpr Quaternion operator*(Quaternion const& quaternion, float scalar)
+	{
+		return Quaternion(quaternion.m_x * scalar, quaternion.m_y * scalar, quaternion.m_z * scalar, quaternion.m_w * scalar);
+	}
+
+	constexpr Quaternion operator*(float scalar, Quaternion const& quaternion)
+	{
+		return quaternion * scalar;
+	}
+
+	constexpr Quaternion& operator*=(Quaternion& left, Quaternion const& right)
+	{
+		return left = left * right;
+	}
+
+	constexpr Quaternion& operator*=(Quaternion& quaternion, float scalar)
+	{
+		return quaternion = quaternion * scalar;
+	}
+}
+
+#endif // !__LIBMATH__QUATERNION_INL__
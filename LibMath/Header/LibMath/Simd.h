@@ -0,0 +1,22 @@
+#ifndef __LIBMATH__SIMD_H__
+#define __LIBMATH__SIMD_H__
+
+// Instruction set used by LibMath kernels, picked at compile time.
+// Define LIBMATH_NO_SIMD to force the scalar fallback.
+#if !defined(LIBMATH_NO_SIMD)
+
+	#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+		#define LIBMATH_SSE 1
+	#endif
+
+	#if defined(LIBMATH_SSE) && defined(__AVX__)
+		#define LIBMATH_AVX 1
+	#endif
+
+#endif
+
+#if defined(LIBMATH_SSE)
+	#include <immintrin.h>
+#endif
+
+#endif // !__LIBMATH__SIMD_H__
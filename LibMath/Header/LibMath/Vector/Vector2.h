@@ -12,27 +12,27 @@ namespace LibMath
 	class Vector2
 	{
 	public:
-						Vector2();
-		explicit		Vector2(float);
-						Vector2(float, float);
-						Vector2(const Vector2&);
-						~Vector2();
+		constexpr				Vector2();
+		constexpr explicit		Vector2(float);
+		constexpr				Vector2(float, float);
+		constexpr				Vector2(const Vector2&) = default;
+		constexpr				~Vector2() = default;
 
 
-		Vector2&		operator=(const Vector2&);
+		constexpr Vector2&		operator=(const Vector2&) = default;
 
-		float&			operator[](int);
-		float			operator[](int) const;
+		constexpr float&		operator[](int);
+		constexpr float			operator[](int) const;
 
-		Radian			angleFrom(const Vector2&);
+		Radian					angleFrom(const Vector2&);
 
-		float			dot(const Vector2&);
-		float			cross(const Vector2&);
+		constexpr float			dot(const Vector2&);
+		constexpr float			cross(const Vector2&);
 
-		float			magnitude();
-		float			magnitudeSquared();
+		inline float			magnitude();
+		constexpr float			magnitudeSquared();
 
-		void			normalize(void);
+		inline void				normalize(void);
 		void			projectOnto(Vector2 const&);					// project this vector onto an other
 
 		void			reflectOnto(Vector2 const&);					// reflect this vector by an other
@@ -54,4 +54,6 @@ namespace LibMath
 	};
 }
 
+#include "Vector2.inl"
+
 #endif // !__LIBMATH__VECTOR__VECTOR2_H__
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef __LIBMATH__VECTOR__VECTOR2_INL__
+#define __LIBMATH__VECTOR__VECTOR2_INL__
+
+#include "../Arithmetic.h"
+
+namespace LibMath
+{
+	constexpr Vector2::Vector2() {}
+
+	constexpr Vector2::Vector2(float val)
+		: m_x(val), m_y(val) {}
+
+	constexpr Vector2::Vector2(float x, float y)
+		: m_x(x), m_y(y) {}
+
+	constexpr float& Vector2::operator[](int index)
+	{
+		return (index == 0) ? m_x : m_y;
+	}
+
+	constexpr float Vector2::operator[](int index) const
+	{
+		switch (index)
+		{
+		case 0:
+			return m_x;
+		case 1:
+			return m_y;
+		default:
+			return 0.F;
+		}
+	}
+
+	constexpr float Vector2::dot(const Vector2& other)
+	{
+		return (m_x * other.m_x) + (m_y * other.m_y);
+	}
+
+	constexpr float Vector2::cross(const Vector2& other)
+	{
+		return (m_x * other.m_y) - (m_y * other.m_x);
+	}
+
+	inline float Vector2::magnitude()
+	{
+		return squareRoot((m_x * m_x) + (m_y * m_y));
+	}
+
+	constexpr float Vector2::magnitudeSquared()
+	{
+		return (m_x * m_x) + (m_y * m_y);
+	}
+
+	inline void Vector2::normalize(void)
+	{
+		float mag = magnitude();
+
+		m_x /= mag;
+		m_y /= mag;
+	}
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR2_INL__
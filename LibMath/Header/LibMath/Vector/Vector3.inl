@@ -0,0 +1,280 @@
+#ifndef __LIBMATH__VECTOR__VECTOR3_INL__
+#define __LIBMATH__VECTOR__VECTOR3_INL__
+
+#include "Vector2.h"
+#include "../Arithmetic.h"
+
+namespace LibMath
+{
+	constexpr Vector3::Vector3() {}
+
+	constexpr Vector3::Vector3(float val)
+		: m_x(val), m_y(val), m_z(val) {}
+
+	constexpr Vector3::Vector3(float x, float y, float z)
+		: m_x(x), m_y(y), m_z(z) {}
+
+	constexpr Vector3 Vector3::zero()
+	{
+		return Vector3(0.F, 0.F, 0.F);
+	}
+
+	constexpr Vector3 Vector3::one()
+	{
+		return Vector3(1.F, 1.F, 1.F);
+	}
+
+	constexpr Vector3 Vector3::up()
+	{
+		return Vector3(0.F, 1.F, 0.F);
+	}
+
+	constexpr Vector3 Vector3::down()
+	{
+		return Vector3(0.F, -1.F, 0.F);
+	}
+
+	constexpr Vector3 Vector3::left()
+	{
+		return Vector3(-1.F, 0.F, 0.F);
+	}
+
+	constexpr Vector3 Vector3::right()
+	{
+		return Vector3(1.F, 0.F, 0.F);
+	}
+
+	constexpr Vector3 Vector3::front()
+	{
+		return Vector3(0.F, 0.F, 1.F);
+	}
+
+	constexpr Vector3 Vector3::back()
+	{
+		return Vector3(0.F, 0.F, -1.F);
+	}
+
+	constexpr float& Vector3::operator[](int index)
+	{
+		switch (index)
+		{
+		case 0:
+			return m_x;
+		case 1:
+			return m_y;
+		default:
+			return m_z;
+		}
+	}
+
+	constexpr float Vector3::operator[](int index) const
+	{
+		switch (index)
+		{
+		case 0:
+			return m_x;
+		case 1:
+			return m_y;
+		case 2:
+			return m_z;
+		default:
+			return 0.F;
+		}
+	}
+
+	constexpr Vector3 Vector3::cross(Vector3 const& other) const
+	{
+		return Vector3((m_y * other.m_z) - (m_z * other.m_y),
+					   (m_z * other.m_x) - (m_x * other.m_z),
+					   (m_x * other.m_y) - (m_y * other.m_x));
+	}
+
+	inline float Vector3::distanceFrom(Vector3 const& other) const
+	{
+		return (other - *this).magnitude();
+	}
+
+	constexpr float Vector3::distanceSquaredFrom(Vector3 const& other) const
+	{
+		return (other - *this).magnitudeSquared();
+	}
+
+	inline float Vector3::distance2DFrom(Vector3 const& other) const
+	{
+		float diffX = other.m_x - m_x,
+			  diffY = other.m_y - m_y;
+
+		return squareRoot((diffX * diffX) + (diffY * diffY));
+	}
+
+	constexpr float Vector3::distance2DSquaredFrom(Vector3 const& other) const
+	{
+		float diffX = other.m_x - m_x,
+			  diffY = other.m_y - m_y;
+
+		return (diffX * diffX) + (diffY * diffY);
+	}
+
+	constexpr float Vector3::dot(Vector3 const& other) const
+	{
+		return (m_x * other.m_x) + (m_y * other.m_y) + (m_z * other.m_z);
+	}
+
+	inline bool Vector3::isLongerThan(Vector3 const& other) const
+	{
+		return magnitudeSquared() > other.magnitudeSquared();
+	}
+
+	inline bool Vector3::isShorterThan(Vector3 const& other) const
+	{
+		return magnitudeSquared() < other.magnitudeSquared();
+	}
+
+	inline bool Vector3::isUnitVector() const
+	{
+		return magnitude() == 1.F;
+	}
+
+	inline float Vector3::magnitude() const
+	{
+		return squareRoot((m_x * m_x) + (m_y * m_y) + (m_z * m_z));
+	}
+
+	constexpr float Vector3::magnitudeSquared() const
+	{
+		return (m_x * m_x) + (m_y * m_y) + (m_z * m_z);
+	}
+
+	inline void Vector3::normalize()
+	{
+		float mag = magnitude();
+
+		m_x /= mag;
+		m_y /= mag;
+		m_z /= mag;
+	}
+
+	inline Vector3 Vector3::normalizedCopy() const
+	{
+		Vector3 normalized = *this;
+
+		normalized.normalize();
+
+		return normalized;
+	}
+
+	inline void Vector3::projectOnto(Vector3 const& dest)
+	{
+		float projTerm = dot(dest) / dest.magnitudeSquared();
+
+		m_x = projTerm * dest.m_x;
+		m_y = projTerm * dest.m_y;
+		m_z = projTerm * dest.m_z;
+	}
+
+	inline void Vector3::reflectOnto(Vector3 const& axis)
+	{
+		Vector3 normalizedAxis = axis.normalizedCopy();
+
+		*this -= (this->dot(normalizedAxis) * 2.f) * normalizedAxis;
+	}
+
+	constexpr void Vector3::scale(Vector3 const& other)
+	{
+		*this *= other;
+	}
+
+	constexpr void Vector3::translate(Vector3 const& other)
+	{
+		*this += other;
+	}
+
+	inline Vector2 Vector3::to2D(void)
+	{
+		return Vector2(m_x, m_y);
+	}
+
+
+	constexpr bool operator==(Vector3 const& lhs, Vector3 const& rhs)
+	{
+		return almostEqual(lhs.m_x, rhs.m_x) && almostEqual(lhs.m_y, rhs.m_y) && almostEqual(lhs.m_z, rhs.m_z);
+	}
+
+	constexpr bool operator!=(Vector3 const& lhs, Vector3 const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	constexpr Vector3 operator-(Vector3 rhs)
+	{
+		return Vector3(-rhs.m_x, -rhs.m_y, -rhs.m_z);
+	}
+
+	constexpr Vector3 operator+(Vector3 lhs, Vector3 const& rhs)
+	{
+		return Vector3(lhs.m_x + rhs.m_x, lhs.m_y + rhs.m_y, lhs.m_z + rhs.m_z);
+	}
+
+	constexpr Vector3 operator-(Vector3 const& lhs, Vector3 const& rhs)
+	{
+		return Vector3(lhs.m_x - rhs.m_x, lhs.m_y - rhs.m_y, lhs.m_z - rhs.m_z);
+	}
+
+	constexpr Vector3 operator*(Vector3 lhs, Vector3 const& rhs)
+	{
+		return Vector3(lhs.m_x * rhs.m_x, lhs.m_y * rhs.m_y, lhs.m_z * rhs.m_z);
+	}
+
+	constexpr Vector3 operator/(Vector3 lhs, Vector3 const& rhs)
+	{
+		return Vector3(lhs.m_x / rhs.m_x, lhs.m_y / rhs.m_y, lhs.m_z / rhs.m_z);
+	}
+
+	constexpr Vector3 operator*(Vector3 lhs, float rhs)
+	{
+		return Vector3(lhs.m_x * rhs, lhs.m_y * rhs, lhs.m_z * rhs);
+	}
+
+	constexpr Vector3 operator*(float lhs, Vector3 rhs)
+	{
+		return rhs * lhs;
+	}
+
+	constexpr Vector3& operator+=(Vector3& lhs, Vector3 const& rhs)
+	{
+		lhs.m_x += rhs.m_x;
+		lhs.m_y += rhs.m_y;
+		lhs.m_z += rhs.m_z;
+
+		return lhs;
+	}
+
+	constexpr Vector3& operator-=(Vector3& lhs, Vector3 const& rhs)
+	{
+		lhs.m_x -= rhs.m_x;
+		lhs.m_y -= rhs.m_y;
+		lhs.m_z -= rhs.m_z;
+
+		return lhs;
+	}
+
+	constexpr Vector3& operator*=(Vector3& lhs, Vector3 const& rhs)
+	{
+		lhs.m_x *= rhs.m_x;
+		lhs.m_y *= rhs.m_y;
+		lhs.m_z *= rhs.m_z;
+
+		return lhs;
+	}
+
+	constexpr Vector3& operator/=(Vector3& lhs, Vector3 const& rhs)
+	{
+		lhs.m_x /= rhs.m_x;
+		lhs.m_y /= rhs.m_y;
+		lhs.m_z /= rhs.m_z;
+
+		return lhs;
+	}
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR3_INL__
@@ -11,29 +11,29 @@ namespace LibMath
 	{
 	public:
 
-		Vector4() = default;
+		constexpr Vector4() = default;
 
-		Vector4(const Vector4& other);
-		Vector4(const Vector3& other);
-		Vector4(const Vector3& other, float w);
+		constexpr Vector4(const Vector4& other) = default;
+		constexpr Vector4(const Vector3& other);
+		constexpr Vector4(const Vector3& other, float w);
 
-		Vector4(float x, float y, float z, float w);
+		constexpr Vector4(float x, float y, float z, float w);
 
-		Vector4(const Vector2& first, const Vector2& second);
+		constexpr Vector4(const Vector2& first, const Vector2& second);
 
-		~Vector4() = default;
+		constexpr ~Vector4() = default;
 
-		Vector3		to3D(void);
+		constexpr Vector3		to3D(void);
 
-		operator	Vector3() const;
+		constexpr operator		Vector3() const;
 
-		Vector4&	operator=(const Vector4& rhs);
-		Vector4&	operator=(const Vector3& rhs);
-		float&		operator[](int index);
-		float		operator[](int index) const;
+		constexpr Vector4&		operator=(const Vector4& rhs) = default;
+		constexpr Vector4&		operator=(const Vector3& rhs);
+		constexpr float&		operator[](int index);
+		constexpr float			operator[](int index) const;
 
-		Vector4&	operator/=(float divisor);
-		Vector4		operator*(float rhs);
+		constexpr Vector4&		operator/=(float divisor);
+		constexpr Vector4		operator*(float rhs);
 
 
 		float m_x = 0.f;
@@ -43,6 +43,8 @@ namespace LibMath
 	};
 }
 
+#include "Vector4.inl"
+
 #ifdef __LIBMATH__MATRIX__MATRIX4_H__
 #include "../Matrix4Vector4Operation.h"
 #endif // __LIBMATH__MATRIX__MATRIX4_H__
@@ -0,0 +1,90 @@
+#ifndef __LIBMATH__VECTOR__VECTOR4_INL__
+#define __LIBMATH__VECTOR__VECTOR4_INL__
+
+namespace LibMath
+{
+	constexpr Vector4::Vector4(const Vector3& other)
+		: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z)
+	{}
+
+	constexpr Vector4::Vector4(const Vector3& other, float w)
+		: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z), m_w(w)
+	{}
+
+	constexpr Vector4::Vector4(float x, float y, float z, float w)
+		: m_x(x), m_y(y), m_z(z), m_w(w)
+	{}
+
+	constexpr Vector4::Vector4(const Vector2& first, const Vector2& second)
+		: m_x(first.m_x), m_y(first.m_y), m_z(second.m_x), m_w(second.m_y)
+	{}
+
+	constexpr Vector4::operator Vector3() const
+	{
+		return Vector3(m_x, m_y, m_z);
+	}
+
+	constexpr Vector4& Vector4::operator=(const Vector3& rhs)
+	{
+		m_x = rhs.m_x;
+		m_y = rhs.m_y;
+		m_z = rhs.m_z;
+		m_w = 1.f;
+
+		return *this;
+	}
+
+	constexpr float& Vector4::operator[](int index)
+	{
+		switch (index)
+		{
+		case 0:
+			return m_x;
+		case 1:
+			return m_y;
+		case 2:
+			return m_z;
+		default:
+			return m_w;
+		}
+	}
+
+	constexpr float Vector4::operator[](int index) const
+	{
+		switch (index)
+		{
+		case 0:
+			return m_x;
+		case 1:
+			return m_y;
+		case 2:
+			return m_z;
+		case 3:
+			return m_w;
+		default:
+			return 0.F;
+		}
+	}
+
+	constexpr Vector3 Vector4::to3D(void)
+	{
+		return Vector3(m_x, m_y, m_z);
+	}
+
+	constexpr Vector4& Vector4::operator/=(float divisor)
+	{
+		m_x /= divisor;
+		m_y /= divisor;
+		m_z /= divisor;
+		m_w /= divisor;
+
+		return *this;
+	}
+
+	constexpr Vector4 Vector4::operator*(float rhs)
+	{
+		return Vector4(m_x * rhs, m_y * rhs, m_z * rhs, m_w * rhs);
+	}
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR4_INL__
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Batch.h"
+#include "Simd.h"
+
+/*
+	Every kernel computes out = x * row0 + y * row1 + z * row2 (+ row3)
+	Matrix elements are broadcast once, then the inner loop is a plain
+	multiply/add on packed x, y & z, no shuffle needed thanks to the
+	structure of arrays layout
+*/
+
+namespace
+{
+	size_t BatchSize(LibMath::ConstVector3Span const& input, LibMath::Vector3Span const& output)
+	{
+		return std::min(input.size(), output.size());
+	}
+
+	// Scalar tail & fallback, w is 1 for points & 0 for directions
+	void TransformScalar(LibMath::Matrix4 const& matrix, LibMath::ConstVector3Span const& input, LibMath::Vector3Span const& output,
+						 float w, size_t begin, size_t end)
+	{
+		const float (&m)[4][4] = matrix.m_matrix;
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float x = input.m_x[i], y = input.m_y[i], z = input.m_z[i];
+
+			output.m_x[i] = x * m[0][0] + y * m[1][0] + z * m[2][0] + w * m[3][0];
+			output.m_y[i] = x * m[0][1] + y * m[1][1] + z * m[2][1] + w * m[3][1];
+			output.m_z[i] = x * m[0][2] + y * m[1][2] + z * m[2][2] + w * m[3][2];
+		}
+	}
+
+	void Transform(LibMath::Matrix4 const& matrix, LibMath::ConstVector3Span const& input, LibMath::Vector3Span const& output, float w)
+	{
+		const size_t	count = BatchSize(input, output);
+		size_t			i = 0;
+
+#if defined(LIBMATH_AVX)
+
+		const float (&m)[4][4] = matrix.m_matrix;
+
+		const __m256 m00 = _mm256_set1_ps(m[0][0]), m01 = _mm256_set1_ps(m[0][1]), m02 = _mm256_set1_ps(m[0][2]);
+		const __m256 m10 = _mm256_set1_ps(m[1][0]), m11 = _mm256_set1_ps(m[1][1]), m12 = _mm256_set1_ps(m[1][2]);
+		const __m256 m20 = _mm256_set1_ps(m[2][0]), m21 = _mm256_set1_ps(m[2][1]), m22 = _mm256_set1_ps(m[2][2]);
+		const __m256 m30 = _mm256_set1_ps(w * m[3][0]), m31 = _mm256_set1_ps(w * m[3][1]), m32 = _mm256_set1_ps(w * m[3][2]);
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(&input.m_x[i]);
+			const __m256 y = _mm256_loadu_ps(&input.m_y[i]);
+			const __m256 z = _mm256_loadu_ps(&input.m_z[i]);
+
+			__m256 outX = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m00), _mm256_mul_ps(y, m10)), _mm256_add_ps(_mm256_mul_ps(z, m20), m30));
+			__m256 outY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m01), _mm256_mul_ps(y, m11)), _mm256_add_ps(_mm256_mul_ps(z, m21), m31));
+			__m256 outZ = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m02), _mm256_mul_ps(y, m12)), _mm256_add_ps(_mm256_mul_ps(z, m22), m32));
+
+			_mm256_storeu_ps(&output.m_x[i], outX);
+			_mm256_storeu_ps(&output.m_y[i], outY);
+			_mm256_storeu_ps(&output.m_z[i], outZ);
+		}
+
+#elif defined(LIBMATH_SSE)
+
+		const float (&m)[4][4] = matrix.m_matrix;
+
+		const __m128 m00 = _mm_set1_ps(m[0][0]), m01 = _mm_set1_ps(m[0][1]), m02 = _mm_set1_ps(m[0][2]);
+		const __m128 m10 = _mm_set1_ps(m[1][0]), m11 = _mm_set1_ps(m[1][1]), m12 = _mm_set1_ps(m[1][2]);
+		const __m128 m20 = _mm_set1_ps(m[2][0]), m21 = _mm_set1_ps(m[2][1]), m22 = _mm_set1_ps(m[2][2]);
+		const __m128 m30 = _mm_set1_ps(w * m[3][0]), m31 = _mm_set1_ps(w * m[3][1]), m32 = _mm_set1_ps(w * m[3][2]);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(&input.m_x[i]);
+			const __m128 y = _mm_loadu_ps(&input.m_y[i]);
+			const __m128 z = _mm_loadu_ps(&input.m_z[i]);
+
+			__m128 outX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_add_ps(_mm_mul_ps(z, m20), m30));
+			__m128 outY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_add_ps(_mm_mul_ps(z, m21), m31));
+			__m128 outZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_add_ps(_mm_mul_ps(z, m22), m32));
+
+			_mm_storeu_ps(&output.m_x[i], outX);
+			_mm_storeu_ps(&output.m_y[i], outY);
+			_mm_storeu_ps(&output.m_z[i], outZ);
+		}
+
+#endif
+
+		TransformScalar(matrix, input, output, w, i, count);
+	}
+}
+
+size_t LibMath::Vector3Span::size() const
+{
+	return std::min(m_x.size(), std::min(m_y.size(), m_z.size()));
+}
+
+LibMath::ConstVector3Span::ConstVector3Span(std::span<const float> x, std::span<const float> y, std::span<const float> z)
+	: m_x(x), m_y(y), m_z(z)
+{
+}
+
+LibMath::ConstVector3Span::ConstVector3Span(Vector3Span const& other)
+	: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z)
+{
+}
+
+size_t LibMath::ConstVector3Span::size() const
+{
+	return std::min(m_x.size(), std::min(m_y.size(), m_z.size()));
+}
+
+void LibMath::transformPoints(Matrix4 const& matrix, ConstVector3Span input, Vector3Span output)
+{
+	Transform(matrix, input, output, 1.f);
+}
+
+void LibMath::transformDirections(Matrix4 const& matrix, ConstVector3Span input, Vector3Span output)
+{
+	Transform(matrix, input, output, 0.f);
+}
+
+void LibMath::transformAABBs(Matrix4 const& matrix, ConstVector3Span centers, ConstVector3Span extents,
+							 Vector3Span outCenters, Vector3Span outExtents)
+{
+	// Centers move like points
+	transformPoints(matrix, centers, outCenters);
+
+	// Extents go through the absolute value of the 3x3 part (Arvo), enclosing box of the rotated box
+	Matrix4 absolute;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+			absolute.m_matrix[i][j] = std::fabs(matrix.m_matrix[i][j]);
+	}
+
+	transformDirections(absolute, extents, outExtents);
+}
+
+void LibMath::transformAABB(Matrix4 const& matrix, Vector3 const& center, Vector3 const& extents,
+							Vector3& outCenter, Vector3& outExtents)
+{
+	const float (&m)[4][4] = matrix.m_matrix;
+
+	outCenter.m_x = center.m_x * m[0][0] + center.m_y * m[1][0] + center.m_z * m[2][0] + m[3][0];
+	outCenter.m_y = center.m_x * m[0][1] + center.m_y * m[1][1] + center.m_z * m[2][1] + m[3][1];
+	outCenter.m_z = center.m_x * m[0][2] + center.m_y * m[1][2] + center.m_z * m[2][2] + m[3][2];
+
+	outExtents.m_x = extents.m_x * std::fabs(m[0][0]) + extents.m_y * std::fabs(m[1][0]) + extents.m_z * std::fabs(m[2][0]);
+	outExtents.m_y = extents.m_x * std::fabs(m[0][1]) + extents.m_y * std::fabs(m[1][1]) + extents.m_z * std::fabs(m[2][1]);
+	outExtents.m_z = extents.m_x * std::fabs(m[0][2]) + extents.m_y * std::fabs(m[1][2]) + extents.m_z * std::fabs(m[2][2]);
+}
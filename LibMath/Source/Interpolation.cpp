@@ -3,7 +3,7 @@
 
 namespace LibMath
 {
-	float LibMath::blerp(const LibMath::Matrix2& qGrid, const LibMath::Matrix2& gridCoords, const LibMath::Vector2& point)
+	float blerp(const LibMath::Matrix2& qGrid, const LibMath::Matrix2& gridCoords, const LibMath::Vector2& point)
 	{
 		LibMath::Vector2       gridLength(gridCoords.m_matrix[0][1] - gridCoords.m_matrix[0][0], gridCoords.m_matrix[1][1] - gridCoords.m_matrix[1][0]);
 		LibMath::Vector2       pointToEnd(gridCoords.m_matrix[0][1] - point[0], gridCoords.m_matrix[1][1] - point[1]);
@@ -40,7 +40,7 @@ namespace LibMath
 		return low + ratio * (high - low);
 	}
 
-	unsigned char LibMath::lerp(unsigned char low, unsigned char high, unsigned char ratio)
+	unsigned char lerp(unsigned char low, unsigned char high, unsigned char ratio)
 	{
 		if (ratio == 0)
 			return low;
@@ -60,12 +60,12 @@ namespace LibMath
 		return low + ratio * (high - low);
 	}
 
-	float LibMath::getLerpRatio(const float val, const float low, const float high)
+	float getLerpRatio(const float val, const float low, const float high)
 	{
 		return (val - low) / (high - high);
 	}
 
-	Vector3 LibMath::getBarycentricWeights(const Vector2& v1, const Vector2& v2, const Vector2& v3, float x, float y)
+	Vector3 getBarycentricWeights(const Vector2& v1, const Vector2& v2, const Vector2& v3, float x, float y)
 	{
 		float    detDivider = (v2.m_y - v3.m_y) * (v1.m_x - v3.m_x);
 		detDivider += (v3.m_x - v2.m_x) * (v1.m_y - v3.m_y);
@@ -83,12 +83,12 @@ namespace LibMath
 
 	}
 
-	float LibMath::barycentricInterpolate(const Vector3& weights, const float val1, const float val2, const float val3)
+	float barycentricInterpolate(const Vector3& weights, const float val1, const float val2, const float val3)
 	{
 		return weights.m_x * val1 + weights.m_y * val2 + weights.m_z * val3;
 	}
 
-	Vector3 LibMath::tripleBarycentric(const Vector3& weights, const Vector3& val1, const Vector3& val2, const Vector3& val3)
+	Vector3 tripleBarycentric(const Vector3& weights, const Vector3& val1, const Vector3& val2, const Vector3& val3)
 	{
 		return weights.m_x * val1 + weights.m_y * val2 + weights.m_z * val3;
 	}
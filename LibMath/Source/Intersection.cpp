@@ -0,0 +1,378 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "Intersection.h"
+#include "Simd.h"
+
+/*
+	Every kernel is written once against a small set of lane helpers and
+	instantiated twice: with the widest register available (8 floats with
+	AVX, 4 with SSE) for the main loop, and with a plain float for the tail
+	or when SIMD is disabled. Lane results are packed into the hit mask with
+	a movemask, no branch per primitive
+*/
+
+namespace
+{
+	using HitMask = uint32_t;
+
+	// Scalar lane
+
+	float	Load(float, const float* address)	{ return *address; }
+	float	Broadcast(float, float value)		{ return value; }
+	float	Add(float a, float b)				{ return a + b; }
+	float	Sub(float a, float b)				{ return a - b; }
+	float	Mul(float a, float b)				{ return a * b; }
+
+	// Return b if either is NaN, like minps/maxps
+	float	Min(float a, float b)				{ return a < b ? a : b; }
+	float	Max(float a, float b)				{ return a > b ? a : b; }
+
+	bool	LessThan(float a, float b)			{ return a < b; }
+	bool	LessEqual(float a, float b)			{ return a <= b; }
+	bool	Both(bool a, bool b)				{ return a && b; }
+	bool	Either(bool a, bool b)				{ return a || b; }
+	bool	AndNot(bool a, bool b)				{ return a && !b; }
+	bool	AllTrue(float)						{ return true; }
+	bool	NoneTrue(float)						{ return false; }
+	HitMask	Mask(bool value)					{ return value ? 1u : 0u; }
+
+#if defined(LIBMATH_AVX)
+
+	using Wide = __m256;
+	constexpr size_t WideLanes = 8;
+
+	Wide	Load(Wide, const float* address)	{ return _mm256_loadu_ps(address); }
+	Wide	Broadcast(Wide, float value)		{ return _mm256_set1_ps(value); }
+	Wide	Add(Wide a, Wide b)					{ return _mm256_add_ps(a, b); }
+	Wide	Sub(Wide a, Wide b)					{ return _mm256_sub_ps(a, b); }
+	Wide	Mul(Wide a, Wide b)					{ return _mm256_mul_ps(a, b); }
+	Wide	Min(Wide a, Wide b)					{ return _mm256_min_ps(a, b); }
+	Wide	Max(Wide a, Wide b)					{ return _mm256_max_ps(a, b); }
+	Wide	LessThan(Wide a, Wide b)			{ return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	Wide	LessEqual(Wide a, Wide b)			{ return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	Wide	Both(Wide a, Wide b)				{ return _mm256_and_ps(a, b); }
+	Wide	Either(Wide a, Wide b)				{ return _mm256_or_ps(a, b); }
+	Wide	AndNot(Wide a, Wide b)				{ return _mm256_andnot_ps(b, a); }
+	Wide	AllTrue(Wide)						{ return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+	Wide	NoneTrue(Wide)						{ return _mm256_setzero_ps(); }
+	HitMask	Mask(Wide value)					{ return static_cast<HitMask>(_mm256_movemask_ps(value)); }
+	void	Store(float* address, Wide value)	{ _mm256_storeu_ps(address, value); }
+
+#elif defined(LIBMATH_SSE)
+
+	using Wide = __m128;
+	constexpr size_t WideLanes = 4;
+
+	Wide	Load(Wide, const float* address)	{ return _mm_loadu_ps(address); }
+	Wide	Broadcast(Wide, float value)		{ return _mm_set1_ps(value); }
+	Wide	Add(Wide a, Wide b)					{ return _mm_add_ps(a, b); }
+	Wide	Sub(Wide a, Wide b)					{ return _mm_sub_ps(a, b); }
+	Wide	Mul(Wide a, Wide b)					{ return _mm_mul_ps(a, b); }
+	Wide	Min(Wide a, Wide b)					{ return _mm_min_ps(a, b); }
+	Wide	Max(Wide a, Wide b)					{ return _mm_max_ps(a, b); }
+	Wide	LessThan(Wide a, Wide b)			{ return _mm_cmplt_ps(a, b); }
+	Wide	LessEqual(Wide a, Wide b)			{ return _mm_cmple_ps(a, b); }
+	Wide	Both(Wide a, Wide b)				{ return _mm_and_ps(a, b); }
+	Wide	Either(Wide a, Wide b)				{ return _mm_or_ps(a, b); }
+	Wide	AndNot(Wide a, Wide b)				{ return _mm_andnot_ps(b, a); }
+	Wide	AllTrue(Wide)						{ return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+	Wide	NoneTrue(Wide)						{ return _mm_setzero_ps(); }
+	HitMask	Mask(Wide value)					{ return static_cast<HitMask>(_mm_movemask_ps(value)); }
+	void	Store(float* address, Wide value)	{ _mm_storeu_ps(address, value); }
+
+#else
+
+	using Wide = float;
+	constexpr size_t WideLanes = 1;
+
+	// Only the wide loop stores lanes, the scalar tail reads its hit directly
+	void	Store(float* address, float value)	{ *address = value; }
+
+#endif
+
+	// Lanes of a kernel argument, 1 for the scalar tail
+	template <typename T>
+	constexpr size_t LaneCount = std::is_same_v<T, float> ? 1 : WideLanes;
+
+	// Run a kernel over count primitives and pack its lane results into hits
+	template <typename TKernel>
+	size_t BuildMask(size_t count, std::span<uint64_t> hits, TKernel&& kernel)
+	{
+		count = std::min(count, hits.size() * 64);
+
+		const size_t words = LibMath::hitMaskSize(count);
+
+		std::fill(hits.begin(), hits.begin() + words, 0ull);
+
+		size_t	i = 0;
+
+		// Lane groups never straddle two words as 64 is a multiple of the lane count
+		for (; i + WideLanes <= count; i += WideLanes)
+		{
+			const uint64_t laneHits = Mask(kernel(Wide{}, i));
+
+			hits[i / 64] |= laneHits << (i % 64);
+		}
+
+		for (; i < count; ++i)
+		{
+			const uint64_t laneHits = Mask(kernel(float{}, i));
+
+			hits[i / 64] |= laneHits << (i % 64);
+		}
+
+		// Count once per word, popcount may be a library call without POPCNT
+		size_t hitCount = 0;
+
+		for (size_t word = 0; word < words; ++word)
+			hitCount += std::popcount(hits[word]);
+
+		return hitCount;
+	}
+
+	// Slab test, NaN slabs (box face on the origin with an infinite inverse direction) are ignored
+	template <typename T>
+	auto RaySlab(LibMath::Vector3 const& origin, LibMath::Vector3 const& inverseDirection,
+				 LibMath::ConstAABBSpan const& boxes, size_t i, T& entry)
+	{
+		T exit = Broadcast(T{}, std::numeric_limits<float>::infinity());
+
+		entry = Broadcast(T{}, -std::numeric_limits<float>::infinity());
+
+		auto slab = [&](std::span<const float> const& boxMin, std::span<const float> const& boxMax, float start, float inverse)
+		{
+			const T low = Mul(Sub(Load(T{}, &boxMin[i]), Broadcast(T{}, start)), Broadcast(T{}, inverse));
+			const T high = Mul(Sub(Load(T{}, &boxMax[i]), Broadcast(T{}, start)), Broadcast(T{}, inverse));
+
+			// Operand order keeps the running value when a slab is NaN
+			entry = Min(Max(low, entry), Max(high, entry));
+			exit = Max(Min(low, exit), Min(high, exit));
+		};
+
+		slab(boxes.m_min.m_x, boxes.m_max.m_x, origin.m_x, inverseDirection.m_x);
+		slab(boxes.m_min.m_y, boxes.m_max.m_y, origin.m_y, inverseDirection.m_y);
+		slab(boxes.m_min.m_z, boxes.m_max.m_z, origin.m_z, inverseDirection.m_z);
+
+		// Hit if the ray leaves the box in front of its origin, after entering it
+		return LessThan(Max(entry, Broadcast(T{}, 0.f)), exit);
+	}
+
+	// Frustum plane copied to every lane, with the absolute normal for the box radius
+	struct LanePlane
+	{
+		void Set(LibMath::Vector4 const& plane)
+		{
+			std::fill_n(m_x, WideLanes, plane.m_x);
+			std::fill_n(m_y, WideLanes, plane.m_y);
+			std::fill_n(m_z, WideLanes, plane.m_z);
+			std::fill_n(m_absX, WideLanes, std::fabs(plane.m_x));
+			std::fill_n(m_absY, WideLanes, std::fabs(plane.m_y));
+			std::fill_n(m_absZ, WideLanes, std::fabs(plane.m_z));
+			std::fill_n(m_w, WideLanes, plane.m_w);
+		}
+
+		float m_x[WideLanes], m_y[WideLanes], m_z[WideLanes];
+		float m_absX[WideLanes], m_absY[WideLanes], m_absZ[WideLanes];
+		float m_w[WideLanes];
+	};
+}
+
+size_t LibMath::ConstAABBSpan::size() const
+{
+	return std::min(m_min.size(), m_max.size());
+}
+
+size_t LibMath::intersectRayAABBs(Vector3 const& origin, Vector3 const& inverseDirection, ConstAABBSpan boxes,
+								  std::span<uint64_t> hits)
+{
+	return BuildMask(boxes.size(), hits, [&](auto lane, size_t i)
+	{
+		decltype(lane) entry;
+
+		return RaySlab(origin, inverseDirection, boxes, i, entry);
+	});
+}
+
+size_t LibMath::nearestRayAABB(Vector3 const& origin, Vector3 const& inverseDirection, ConstAABBSpan boxes,
+							   float& distance)
+{
+	const size_t	count = boxes.size();
+	size_t			nearest = noHit;
+	size_t			i = 0;
+	float			entries[WideLanes];
+
+	distance = std::numeric_limits<float>::max();
+
+	// Only lanes that hit are scanned for the closest entry distance
+	for (; i + WideLanes <= count; i += WideLanes)
+	{
+		Wide	entry;
+		HitMask	laneHits = Mask(RaySlab(origin, inverseDirection, boxes, i, entry));
+
+		if (!laneHits)
+			continue;
+
+		Store(entries, entry);
+
+		for (size_t lane = 0; laneHits; ++lane, laneHits >>= 1)
+		{
+			if ((laneHits & 1u) && entries[lane] < distance)
+			{
+				distance = entries[lane];
+				nearest = i + lane;
+			}
+		}
+	}
+
+	for (; i < count; ++i)
+	{
+		float entry;
+
+		if (RaySlab(origin, inverseDirection, boxes, i, entry) && entry < distance)
+		{
+			distance = entry;
+			nearest = i;
+		}
+	}
+
+	return nearest;
+}
+
+size_t LibMath::intersectSphereAABBs(Vector3 const& center, float radius, ConstAABBSpan boxes,
+									 std::span<uint64_t> hits)
+{
+	return BuildMask(boxes.size(), hits, [&](auto lane, size_t i)
+	{
+		using T = decltype(lane);
+
+		// Squared distance from the center to its closest point in the box
+		auto axis = [&](std::span<const float> const& boxMin, std::span<const float> const& boxMax, float position)
+		{
+			const T point = Broadcast(T{}, position);
+			const T delta = Sub(Max(Load(T{}, &boxMin[i]), Min(point, Load(T{}, &boxMax[i]))), point);
+
+			return Mul(delta, delta);
+		};
+
+		const T distanceSquared = Add(Add(axis(boxes.m_min.m_x, boxes.m_max.m_x, center.m_x),
+										  axis(boxes.m_min.m_y, boxes.m_max.m_y, center.m_y)),
+									  axis(boxes.m_min.m_z, boxes.m_max.m_z, center.m_z));
+
+		return LessThan(distanceSquared, Broadcast(T{}, radius * radius));
+	});
+}
+
+size_t LibMath::intersectAABBAABBs(Vector3 const& min, Vector3 const& max, ConstAABBSpan boxes,
+								   std::span<uint64_t> hits)
+{
+	return BuildMask(boxes.size(), hits, [&](auto lane, size_t i)
+	{
+		using T = decltype(lane);
+
+		// Overlap on one axis
+		auto axis = [&](std::span<const float> const& boxMin, std::span<const float> const& boxMax, float queryMin, float queryMax)
+		{
+			return Both(LessEqual(Broadcast(T{}, queryMin), Load(T{}, &boxMax[i])),
+						LessEqual(Load(T{}, &boxMin[i]), Broadcast(T{}, queryMax)));
+		};
+
+		return Both(Both(axis(boxes.m_min.m_x, boxes.m_max.m_x, min.m_x, max.m_x),
+						 axis(boxes.m_min.m_y, boxes.m_max.m_y, min.m_y, max.m_y)),
+					axis(boxes.m_min.m_z, boxes.m_max.m_z, min.m_z, max.m_z));
+	});
+}
+
+size_t LibMath::intersectFrustumAABBs(std::span<const Vector4, 6> planes, ConstVector3Span centers, ConstVector3Span extents,
+									  std::span<uint64_t> hits)
+{
+	const size_t count = std::min(centers.size(), extents.size());
+
+	// Broadcast planes once, not once per box group
+	LanePlane lanePlanes[6];
+
+	for (size_t plane = 0; plane < 6; ++plane)
+		lanePlanes[plane].Set(planes[plane]);
+
+	return BuildMask(count, hits, [&](auto lane, size_t i)
+	{
+		using T = decltype(lane);
+
+		const T x = Load(T{}, &centers.m_x[i]), y = Load(T{}, &centers.m_y[i]), z = Load(T{}, &centers.m_z[i]);
+		const T ex = Load(T{}, &extents.m_x[i]), ey = Load(T{}, &extents.m_y[i]), ez = Load(T{}, &extents.m_z[i]);
+
+		auto inside = AllTrue(T{});
+
+		for (size_t plane = 0; plane < 6; ++plane)
+		{
+			LanePlane const& current = lanePlanes[plane];
+
+			// Box is behind the plane if its center distance is below minus its projected radius
+			const T distance = Add(Add(Mul(x, Load(T{}, current.m_x)), Mul(y, Load(T{}, current.m_y))), Mul(z, Load(T{}, current.m_z)));
+			const T radius = Add(Add(Mul(ex, Load(T{}, current.m_absX)), Mul(ey, Load(T{}, current.m_absY))), Mul(ez, Load(T{}, current.m_absZ)));
+
+			inside = Both(inside, LessEqual(Load(T{}, current.m_w), Add(distance, radius)));
+		}
+
+		return inside;
+	});
+}
+
+size_t LibMath::cullFrustumAABBs(std::span<const Vector4, 6> planes, ConstVector3Span centers, ConstVector3Span extents,
+								 std::span<uint8_t> lastPlanes, std::span<uint64_t> hits)
+{
+	const size_t count = std::min({ centers.size(), extents.size(), lastPlanes.size() });
+
+	LanePlane lanePlanes[6];
+
+	for (size_t plane = 0; plane < 6; ++plane)
+		lanePlanes[plane].Set(planes[plane]);
+
+	return BuildMask(count, hits, [&](auto lane, size_t i)
+	{
+		using T = decltype(lane);
+
+		constexpr size_t	lanes = LaneCount<T>;
+		constexpr HitMask	allLanes = (1u << lanes) - 1u;
+
+		const T cx = Load(T{}, &centers.m_x[i]), cy = Load(T{}, &centers.m_y[i]), cz = Load(T{}, &centers.m_z[i]);
+		const T ex = Load(T{}, &extents.m_x[i]), ey = Load(T{}, &extents.m_y[i]), ez = Load(T{}, &extents.m_z[i]);
+
+		// Box is behind a plane if its center distance is below minus its projected radius
+		auto behind = [&](LanePlane const& plane)
+		{
+			const T distance = Add(Add(Mul(cx, Load(T{}, plane.m_x)), Mul(cy, Load(T{}, plane.m_y))), Mul(cz, Load(T{}, plane.m_z)));
+			const T radius = Add(Add(Mul(ex, Load(T{}, plane.m_absX)), Mul(ey, Load(T{}, plane.m_absY))), Mul(ez, Load(T{}, plane.m_absZ)));
+
+			return LessThan(Add(distance, radius), Load(T{}, plane.m_w));
+		};
+
+		// Boxes that stay out of view are usually rejected by the same plane as last time,
+		// tested first when the whole group agrees on it so the plane stays broadcast
+		const uint8_t	cached = lastPlanes[i];
+		bool			shared = cached < 6;
+
+		for (size_t index = 1; index < lanes; ++index)
+			shared = shared && lastPlanes[i + index] == cached;
+
+		auto	rejected = shared ? behind(lanePlanes[cached]) : NoneTrue(T{});
+		HitMask	rejectedMask = Mask(rejected);
+
+		for (size_t plane = 0; plane < 6 && rejectedMask != allLanes; ++plane)
+		{
+			const auto	out = behind(lanePlanes[plane]);
+
+			// Remember the plane for boxes it rejects first
+			for (HitMask newlyOut = Mask(out) & ~rejectedMask; newlyOut; newlyOut &= newlyOut - 1)
+				lastPlanes[i + std::countr_zero(newlyOut)] = static_cast<uint8_t>(plane);
+
+			rejected = Either(rejected, out);
+			rejectedMask = Mask(rejected);
+		}
+
+		return AndNot(AllTrue(T{}), rejected);
+	});
+}
@@ -86,10 +86,10 @@ LibMath::Matrix2 LibMath::Matrix2::Minor(const Matrix2& matrix2)
 {
 	*this = matrix2;
 
-	this->m_matrix[0][0] = std::powf(-1.0f, 2) * this->m_matrix[0][0];
-	this->m_matrix[0][1] = std::powf(-1.0f, 3) * this->m_matrix[0][1];
-	this->m_matrix[1][0] = std::powf(-1.0f, 3) * this->m_matrix[1][0];
-	this->m_matrix[1][1] = std::powf(-1.0f, 4) * this->m_matrix[1][1];
+	this->m_matrix[0][0] = powf(-1.0f, 2) * this->m_matrix[0][0];
+	this->m_matrix[0][1] = powf(-1.0f, 3) * this->m_matrix[0][1];
+	this->m_matrix[1][0] = powf(-1.0f, 3) * this->m_matrix[1][0];
+	this->m_matrix[1][1] = powf(-1.0f, 4) * this->m_matrix[1][1];
 
 	return *this;
 }
@@ -1,86 +1,12 @@
 #include <iostream>
 #include <cerrno>
-#include <float.h>
+#include <cmath>
 
 #include "Matrix/Matrix3.h"
 #include "Matrix/Matrix2.h"
 #include "Arithmetic.h"
 #include "Angle.h"
 
-// Constructor to create a 3x3 identity matrix
-LibMath::Matrix3::Matrix3()
-{
-	// Initialize as identity matrix
-	for (int i = 0; i < 3; i++)
-	{
-		for (int j = 0; j < 3; j++)
-		{
-			this->m_matrix[i][j] = (i == j ? 1.0f : 0.0f);
-		}
-	}
-}
-
-// Constructor to create a 3x3 identity matrix multiplied by a scalar
-LibMath::Matrix3::Matrix3(float scalar)
-{
-	// Initialize as identity matrix multiplied by a scalar
-	for (int i = 0; i < 3; i++)
-	{
-		for (int j = 0; j < 3; j++)
-		{
-			this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
-		}
-	}
-}
-
-LibMath::Matrix3::Matrix3(float* arr)
-{
-	for (int i = 0; i < 9; i++)
-	{
-		if (i < 3)
-			this->m_matrix[0][i] = arr[i];
-		else if (i < 6)
-			this->m_matrix[1][i - 3] = arr[i];
-		else
-			this->m_matrix[2][i - 6] = arr[i];
-	}
-}
-
-// Destructor
-LibMath::Matrix3::~Matrix3()
-{
-}
-
-LibMath::Matrix3 LibMath::Matrix3::Transpose(const Matrix3& matrix)
-{
-	LibMath::Matrix3 matrix3 = matrix;
-
-	// Transpose matrix
-	for (int i = 0; i < 3; i++)
-	{
-		for (int j = 0; j < 3; j++)
-		{
-			this->m_matrix[j][i] = matrix3.m_matrix[i][j];
-		}
-	}
-
-	return *this;
-}
-
-LibMath::Matrix3 LibMath::Matrix3::Identity(float scalar)
-{
-	// Create an identity matrix and multiply by scalar
-	for (int i = 0; i < 3; i++)
-	{
-		for (int j = 0; j < 3; j++)
-		{
-			this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
-		}
-	}
-
-	return *this;
-}
-
 LibMath::Matrix3 LibMath::Matrix3::Minor(const Matrix3& matrix)
 {
 	LibMath::Matrix2 matrix2;
@@ -155,25 +81,6 @@ LibMath::Matrix3 LibMath::Matrix3::Inverse(const Matrix3& matrix)
 	return resultMatrix;
 }
 
-float LibMath::Matrix3::Determinant(const Matrix3& matrix)
-{
-	/*
-		Split 3x3 matrix into 3 2x2 matrix and multiply by the coefficient
-
-		Equation:
-		|a b c|
-		|d e f|
-		|g h i|
-
-		Determinant = a(ei - fh) - b(di - gf) + c(dh - eg)
-	*/
-	float a = matrix.m_matrix[0][0] * ((matrix.m_matrix[1][1] * matrix.m_matrix[2][2]) - (matrix.m_matrix[1][2] * matrix.m_matrix[2][1]));
-	float b = matrix.m_matrix[0][1] * ((matrix.m_matrix[1][0] * matrix.m_matrix[2][2]) - (matrix.m_matrix[1][2] * matrix.m_matrix[2][0]));
-	float c = matrix.m_matrix[0][2] * ((matrix.m_matrix[1][0] * matrix.m_matrix[2][1]) - (matrix.m_matrix[1][1] * matrix.m_matrix[2][0]));
-
-	return a - b + c;
-}
-
 LibMath::Matrix3 LibMath::Matrix3::XRotation(float angle, bool rowMajor)
 {
 	float sinAngle = sinf(angle);
@@ -331,141 +238,3 @@ LibMath::Matrix3& LibMath::Matrix3::GetMatrix3(const Matrix4& matrix4, int row,
 
 	return *this;
 }
-
-LibMath::Matrix3& LibMath::Matrix3::operator=(const Matrix3& matrixB)
-{
-	// Copy all matrix values
-	for (int i = 0; i < 3; ++i)
-	{
-		for (int j = 0; j < 3; ++j)
-		{
-			this->m_matrix[i][j] = matrixB.m_matrix[i][j];
-		}
-	}
-
-	return *this;
-}
-
-LibMath::Matrix3 LibMath::Matrix3::operator+(const Matrix3 matrixB) const
-{
-	Matrix3 tmp;
-
-	for (int i = 0; i < 3; ++i)
-	{
-		for (int j = 0; j < 3; ++j)
-		{
-			tmp.m_matrix[i][j] = this->m_matrix[i][j] + matrixB.m_matrix[i][j];
-		}
-	}
-
-	return tmp;
-}
-
-LibMath::Matrix3 LibMath::Matrix3::operator-(const Matrix3 matrixB) const
-{
-	Matrix3 tmp = LibMath::Matrix3();
-
-	for (int i = 0; i < 3; ++i)
-	{
-		for (int j = 0; j < 3; ++j)
-		{
-			tmp.m_matrix[i][j] = this->m_matrix[i][j] - matrixB.m_matrix[i][j];
-		}
-	}
-
-	return tmp;
-}
-
-LibMath::Matrix3 LibMath::Matrix3::operator*(const Matrix3 matrixB) const
-{
-
-	// Create empty 3x3 matrix
-	float initValues[9] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
-	Matrix3 result(initValues);
-
-	// Iterate through matrix to set the result matrix equal to the result of the 2 matrices multiplied
-	for (int i = 0; i < 3; i++)
-	{
-		for (int j = 0; j < 3; j++)
-		{
-			for (int k = 0; k < 3; k++)
-			{
-				// Add the value obtained from multiplying the 2 matrices row * column
-				result.m_matrix[i][j] += this->m_matrix[i][k] * matrixB.m_matrix[k][j];
-			}
-		}
-	}
-
-	return result;
-}
-
-LibMath::Matrix3 LibMath::Matrix3::operator*(const float num) const
-{
-	Matrix3 tmp;
-
-	for (int i = 0; i < 9; ++i)
-	{
-		tmp.m_matrix[i / 3][i % 3] = m_matrix[i / 3][i % 3] * num;
-	}
-
-	return tmp;
-}
-
-LibMath::Matrix3& LibMath::Matrix3::operator+=(const Matrix3 matrixB)
-{
-	return *this = *this + matrixB;
-}
-
-LibMath::Matrix3& LibMath::Matrix3::operator-=(const Matrix3 matrixB)
-{
-	return *this = *this - matrixB;
-}
-
-LibMath::Matrix3& LibMath::Matrix3::operator*=(const Matrix3 matrixB)
-{
-	return *this = *this * matrixB;
-}
-
-LibMath::Matrix3& LibMath::Matrix3::operator*=(const float& num)
-{
-	return *this = *this * num;
-}
-
-bool LibMath::Matrix3::operator==(const Matrix3 matrixB) const
-{
-	// Check equality via epsilon test
-	float difference = 0.0f;
-
-	for (int i = 0; i < 9; ++i)
-	{
-		float num1 = LibMath::absolute(m_matrix[i / 3][i % 3]);
-		float num2 = LibMath::absolute(matrixB.m_matrix[i / 3][i % 3]);
-
-		float scaledEpsilon = FLT_EPSILON * LibMath::max(num1, num2);
-
-		if (difference > scaledEpsilon)
-			return false;
-	}
-
-	return true;
-}
-
-bool LibMath::Matrix3::operator!=(const Matrix3 matrixB) const
-{
-	// Check equality via epsilon test
-	float difference = 0.0f;
-
-	for (int i = 0; i < 9; ++i)
-	{
-		float num1 = LibMath::absolute(m_matrix[i / 3][i % 3]);
-		float num2 = LibMath::absolute(matrixB.m_matrix[i / 3][i % 3]);
-
-		float scaledEpsilon = FLT_EPSILON * LibMath::max(num1, num2);
-
-		if (difference <= scaledEpsilon)
-			return false;
-	}
-
-	return true;
-}
-
@@ -1,46 +1,40 @@
 #include <cmath>
-#include <float.h>
 
 #include "Matrix/Matrix4.h"
 #include "Matrix/Matrix3.h"
+#include "Quaternion.h"
 #include "Arithmetic.h"
+#include "Simd.h"
 
-LibMath::Matrix4::Matrix4()
-{
-	// Initialize as identity matrix
-	for (int i = 0; i < 4; ++i)
-	{
-		for (int j = 0; j < 4; ++j)
-		{
-			this->m_matrix[i][j] = (i == j ? 1.0f : 0.0f);
-		}
-	}
-}
+#if defined(LIBMATH_SSE)
 
-LibMath::Matrix4::Matrix4(float scalar)
+// 2x2 sub-matrices are packed row by row in a single register: (m00, m01, m10, m11)
+#define LIBMATH_SHUFFLE(vecA, vecB, x, y, z, w) _mm_shuffle_ps(vecA, vecB, _MM_SHUFFLE(w, z, y, x))
+#define LIBMATH_SWIZZLE(vec, x, y, z, w)		 _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(w, z, y, x))
+
+// Return A * B
+static inline __m128 Mat2Mul(__m128 matA, __m128 matB)
 {
-	// Initialize as identity matrix multiplied by a scalar
-	for (int i = 0; i < 4; ++i)
-	{
-		for (int j = 0; j < 4; ++j)
-		{
-			this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
-		}
-	}
+	return _mm_add_ps(_mm_mul_ps(matA, LIBMATH_SWIZZLE(matB, 0, 3, 0, 3)),
+					  _mm_mul_ps(LIBMATH_SWIZZLE(matA, 1, 0, 3, 2), LIBMATH_SWIZZLE(matB, 2, 1, 2, 1)));
 }
 
-LibMath::Matrix4::Matrix4(float arr[4][4])
+// Return adjugate(A) * B
+static inline __m128 Mat2AdjMul(__m128 matA, __m128 matB)
 {
-	for (int i = 0; i < 16; ++i)
-	{
-		this->m_matrix[i / 4][i % 4] = arr[i / 4][i % 4];
-	}
+	return _mm_sub_ps(_mm_mul_ps(LIBMATH_SWIZZLE(matA, 3, 3, 0, 0), matB),
+					  _mm_mul_ps(LIBMATH_SWIZZLE(matA, 1, 1, 2, 2), LIBMATH_SWIZZLE(matB, 2, 3, 0, 1)));
 }
 
-LibMath::Matrix4::~Matrix4()
+// Return A * adjugate(B)
+static inline __m128 Mat2MulAdj(__m128 matA, __m128 matB)
 {
+	return _mm_sub_ps(_mm_mul_ps(matA, LIBMATH_SWIZZLE(matB, 3, 0, 3, 0)),
+					  _mm_mul_ps(LIBMATH_SWIZZLE(matA, 1, 0, 3, 2), LIBMATH_SWIZZLE(matB, 2, 1, 2, 1)));
 }
 
+#endif
+
 float LibMath::Matrix4::Determinant(const Matrix4& matrix)
 {
 	float determinant = 0.0f;
@@ -65,35 +59,6 @@ float LibMath::Matrix4::Determinant(const Matrix4& matrix)
 	return determinant;
 }
 
-LibMath::Matrix4 LibMath::Matrix4::Identity(float scalar)
-{
-	for (int i = 0; i < 4; ++i)
-	{
-		for (int j = 0; j < 4; ++j)
-		{
-			this->m_matrix[i][j] = (i == j ? scalar : 0.0f);
-		}
-	}
-
-	return *this;
-}
-
-LibMath::Matrix4 LibMath::Matrix4::Transpose(const Matrix4& matrix)
-{
-	LibMath::Matrix4 matrix4 = matrix;
-
-	// Transpose matrix
-	for (int i = 0; i < 4; ++i)
-	{
-		for (int j = 0; j < 4; ++j)
-		{
-			this->m_matrix[j][i] = matrix4.m_matrix[i][j];
-		}
-	}
-
-	return *this;
-}
-
 LibMath::Matrix4 LibMath::Matrix4::Minor(const Matrix4& matrix)
 {
 	LibMath::Matrix3 matrix3;
@@ -141,6 +106,71 @@ LibMath::Matrix4 LibMath::Matrix4::Adjugate(Matrix4& matrix)
 
 LibMath::Matrix4 LibMath::Matrix4::GetInverse() const
 {
+#if defined(LIBMATH_SSE)
+
+	// Block-wise inverse: the matrix is split into four 2x2 blocks
+	// | A B |
+	// | C D |
+	__m128 row0 = _mm_loadu_ps(this->m_matrix[0]);
+	__m128 row1 = _mm_loadu_ps(this->m_matrix[1]);
+	__m128 row2 = _mm_loadu_ps(this->m_matrix[2]);
+	__m128 row3 = _mm_loadu_ps(this->m_matrix[3]);
+
+	__m128 blockA = _mm_movelh_ps(row0, row1);
+	__m128 blockB = _mm_movehl_ps(row1, row0);
+	__m128 blockC = _mm_movelh_ps(row2, row3);
+	__m128 blockD = _mm_movehl_ps(row3, row2);
+
+	// Determinant of each block as (|A|, |B|, |C|, |D|)
+	__m128 detSub = _mm_sub_ps(
+		_mm_mul_ps(LIBMATH_SHUFFLE(row0, row2, 0, 2, 0, 2), LIBMATH_SHUFFLE(row1, row3, 1, 3, 1, 3)),
+		_mm_mul_ps(LIBMATH_SHUFFLE(row0, row2, 1, 3, 1, 3), LIBMATH_SHUFFLE(row1, row3, 0, 2, 0, 2)));
+
+	__m128 detA = LIBMATH_SWIZZLE(detSub, 0, 0, 0, 0);
+	__m128 detB = LIBMATH_SWIZZLE(detSub, 1, 1, 1, 1);
+	__m128 detC = LIBMATH_SWIZZLE(detSub, 2, 2, 2, 2);
+	__m128 detD = LIBMATH_SWIZZLE(detSub, 3, 3, 3, 3);
+
+	__m128 adjDC = Mat2AdjMul(blockD, blockC);
+	__m128 adjAB = Mat2AdjMul(blockA, blockB);
+
+	// Adjugates of the inverse blocks
+	__m128 adjX = _mm_sub_ps(_mm_mul_ps(detD, blockA), Mat2Mul(blockB, adjDC));
+	__m128 adjW = _mm_sub_ps(_mm_mul_ps(detA, blockD), Mat2Mul(blockC, adjAB));
+	__m128 adjY = _mm_sub_ps(_mm_mul_ps(detB, blockC), Mat2MulAdj(blockD, adjAB));
+	__m128 adjZ = _mm_sub_ps(_mm_mul_ps(detC, blockB), Mat2MulAdj(blockA, adjDC));
+
+	// |M| = |A||D| + |B||C| - trace(adj(A)B * adj(D)C)
+	__m128 trace = _mm_mul_ps(adjAB, LIBMATH_SWIZZLE(adjDC, 0, 2, 1, 3));
+	trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+	trace = _mm_add_ps(trace, LIBMATH_SWIZZLE(trace, 1, 1, 1, 1));
+	trace = LIBMATH_SWIZZLE(trace, 0, 0, 0, 0);
+
+	__m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+	// Check determinant is not zero
+	if (_mm_cvtss_f32(det) == 0.0f)
+		return LibMath::Matrix4();
+
+	__m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+	adjX = _mm_mul_ps(adjX, invDet);
+	adjY = _mm_mul_ps(adjY, invDet);
+	adjZ = _mm_mul_ps(adjZ, invDet);
+	adjW = _mm_mul_ps(adjW, invDet);
+
+	// Undo the adjugate swizzle while writing the rows back
+	LibMath::Matrix4 resultMatrix;
+
+	_mm_storeu_ps(resultMatrix.m_matrix[0], LIBMATH_SHUFFLE(adjX, adjY, 3, 1, 3, 1));
+	_mm_storeu_ps(resultMatrix.m_matrix[1], LIBMATH_SHUFFLE(adjX, adjY, 2, 0, 2, 0));
+	_mm_storeu_ps(resultMatrix.m_matrix[2], LIBMATH_SHUFFLE(adjZ, adjW, 3, 1, 3, 1));
+	_mm_storeu_ps(resultMatrix.m_matrix[3], LIBMATH_SHUFFLE(adjZ, adjW, 2, 0, 2, 0));
+
+	return resultMatrix;
+
+#else
+
 	// Check if inverse exists
 	LibMath::Matrix4 matrixCopy = *this;
 	LibMath::Matrix4 resultMatrix;
@@ -153,6 +183,49 @@ LibMath::Matrix4 LibMath::Matrix4::GetInverse() const
 
 	resultMatrix = matrixCopy.Adjugate(matrixCopy) * (1.0f / det);
 
+	return resultMatrix;
+
+#endif
+}
+
+LibMath::Matrix4 LibMath::Matrix4::GetAffineInverse() const
+{
+	// Cofactors of the upper 3x3 block
+	float cofactor00 = m_matrix[1][1] * m_matrix[2][2] - m_matrix[1][2] * m_matrix[2][1];
+	float cofactor01 = m_matrix[1][2] * m_matrix[2][0] - m_matrix[1][0] * m_matrix[2][2];
+	float cofactor02 = m_matrix[1][0] * m_matrix[2][1] - m_matrix[1][1] * m_matrix[2][0];
+
+	float det = m_matrix[0][0] * cofactor00 + m_matrix[0][1] * cofactor01 + m_matrix[0][2] * cofactor02;
+
+	LibMath::Matrix4 resultMatrix;
+
+	// Check determinant is not zero
+	if (det == 0.0f)
+		return resultMatrix;
+
+	float invDet = 1.0f / det;
+
+	// Inverse of the 3x3 block (transposed cofactors)
+	resultMatrix.m_matrix[0][0] = cofactor00 * invDet;
+	resultMatrix.m_matrix[1][0] = cofactor01 * invDet;
+	resultMatrix.m_matrix[2][0] = cofactor02 * invDet;
+
+	resultMatrix.m_matrix[0][1] = (m_matrix[0][2] * m_matrix[2][1] - m_matrix[0][1] * m_matrix[2][2]) * invDet;
+	resultMatrix.m_matrix[1][1] = (m_matrix[0][0] * m_matrix[2][2] - m_matrix[0][2] * m_matrix[2][0]) * invDet;
+	resultMatrix.m_matrix[2][1] = (m_matrix[0][1] * m_matrix[2][0] - m_matrix[0][0] * m_matrix[2][1]) * invDet;
+
+	resultMatrix.m_matrix[0][2] = (m_matrix[0][1] * m_matrix[1][2] - m_matrix[0][2] * m_matrix[1][1]) * invDet;
+	resultMatrix.m_matrix[1][2] = (m_matrix[0][2] * m_matrix[1][0] - m_matrix[0][0] * m_matrix[1][2]) * invDet;
+	resultMatrix.m_matrix[2][2] = (m_matrix[0][0] * m_matrix[1][1] - m_matrix[0][1] * m_matrix[1][0]) * invDet;
+
+	// Inverse translation: -translation * inverse(3x3)
+	for (int j = 0; j < 3; ++j)
+	{
+		resultMatrix.m_matrix[3][j] = -(m_matrix[3][0] * resultMatrix.m_matrix[0][j] +
+										m_matrix[3][1] * resultMatrix.m_matrix[1][j] +
+										m_matrix[3][2] * resultMatrix.m_matrix[2][j]);
+	}
+
 	return resultMatrix;
 }
 
@@ -264,7 +337,7 @@ LibMath::Matrix4 LibMath::Matrix4::Translate(const Vector3& translation, bool ro
 			{1.f, 0.f, 0.f, 0.f},
 			{0.f, 1.f, 0.f, 0.f},
 			{0.f, 0.f, 1.f, 0.f},
-			{translation.m_x, translation.m_x, translation.m_x, 1.f}
+			{translation.m_x, translation.m_y, translation.m_z, 1.f}
 		};
 
 		return Matrix4(matrix);
@@ -284,6 +357,24 @@ LibMath::Matrix4 LibMath::Matrix4::Scale(const Vector3& scale)
 	return Matrix4(matrix);
 }
 
+LibMath::Matrix4 LibMath::Matrix4::Transform(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
+{
+	// Same as Scale(scale) * rotation.toMatrix4() * Translate(translation) without the two 4x4 multiplies
+	const float xx = rotation.m_x * rotation.m_x, yy = rotation.m_y * rotation.m_y, zz = rotation.m_z * rotation.m_z;
+	const float xy = rotation.m_x * rotation.m_y, xz = rotation.m_x * rotation.m_z, yz = rotation.m_y * rotation.m_z;
+	const float wx = rotation.m_w * rotation.m_x, wy = rotation.m_w * rotation.m_y, wz = rotation.m_w * rotation.m_z;
+
+	float matrix[4][4] =
+	{
+		{(1.f - 2.f * (yy + zz)) * scale.m_x,	2.f * (xy + wz) * scale.m_x,			2.f * (xz - wy) * scale.m_x,			0.f},
+		{2.f * (xy - wz) * scale.m_y,			(1.f - 2.f * (xx + zz)) * scale.m_y,	2.f * (yz + wx) * scale.m_y,			0.f},
+		{2.f * (xz + wy) * scale.m_z,			2.f * (yz - wx) * scale.m_z,			(1.f - 2.f * (xx + yy)) * scale.m_z,	0.f},
+		{translation.m_x,						translation.m_y,						translation.m_z,						1.f}
+	};
+
+	return Matrix4(matrix);
+}
+
 LibMath::Matrix4 LibMath::Matrix4::PerspectiveProjection(float fovy, float aspect, float near, float far)
 {
 	LibMath::Matrix4 projectionMatrix;
@@ -317,139 +408,6 @@ LibMath::Matrix4 LibMath::Matrix4::Orthographique(LibMath::Vector3 min, LibMath:
 	return ortho;
 }
 
-LibMath::Matrix4& LibMath::Matrix4::operator=(const Matrix4& matrixB)
-{
-	for (int i = 0; i < 16; ++i)
-	{
-		this->m_matrix[i / 4][i % 4] = matrixB.m_matrix[i / 4][i % 4];
-	}
-
-	return *this;
-}
-
-LibMath::Matrix4 LibMath::Matrix4::operator+(const Matrix4& matrixB) const
-{
-	LibMath::Matrix4 result = LibMath::Matrix4();
-
-	for (int i = 0; i < 16; ++i)
-	{
-		result.m_matrix[i / 4][i % 4] = this->m_matrix[i / 4][i % 4] + matrixB.m_matrix[i / 4][i % 4];
-	}
-
-	return result;
-}
-
-LibMath::Matrix4 LibMath::Matrix4::operator-(const Matrix4& matrixB) const
-{
-	LibMath::Matrix4 result = LibMath::Matrix4();
-
-	for (int i = 0; i < 16; ++i)
-	{
-		result.m_matrix[i / 4][i % 4] = this->m_matrix[i / 4][i % 4] - matrixB.m_matrix[i / 4][i % 4];
-	}
-
-	return result;
-}
-
-LibMath::Matrix4 LibMath::Matrix4::operator*(const Matrix4& matrixB) const
-{
-	// Create a null 4x4 matrix
-	float initValues[4][4] =
-	{
-		{0.0f, 0.0f, 0.0f, 0.0f},
-		{0.0f, 0.0f, 0.0f, 0.0f},
-		{0.0f, 0.0f, 0.0f, 0.0f},
-		{0.0f, 0.0f, 0.0f, 0.0f}
-	};
-
-	LibMath::Matrix4 result = LibMath::Matrix4(initValues);
-
-	// Iterate through matrix to set the result matrix equal to the result of the 2 matrices multiplied
-	for (int i = 0; i < 4; ++i)
-	{
-		for (int j = 0; j < 4; ++j)
-		{
-			for (int k = 0; k < 4; ++k)
-			{
-				// Add the value obtained from multiplying the 2 matrices row * column
-				result.m_matrix[i][j] += this->m_matrix[i][k] * matrixB.m_matrix[k][j];
-			}
-		}
-	}
-
-	return result;
-}
-
-LibMath::Matrix4 LibMath::Matrix4::operator*(const float& num) const
-{
-	Matrix4 tmp = LibMath::Matrix4();
-
-	for (int i = 0; i < 16; ++i)
-	{
-		tmp.m_matrix[i / 4][i % 4] = m_matrix[i / 4][i % 4] * num;
-	}
-
-	return tmp;
-}
-
-LibMath::Matrix4& LibMath::Matrix4::operator+=(const Matrix4 matrixB)
-{
-	return *this = *this + matrixB;
-}
-
-LibMath::Matrix4& LibMath::Matrix4::operator-=(const Matrix4 matrixB)
-{
-	return *this = *this - matrixB;
-}
-
-LibMath::Matrix4& LibMath::Matrix4::operator*=(const Matrix4 matrixB)
-{
-	return *this = *this * matrixB;
-}
-
-LibMath::Matrix4& LibMath::Matrix4::operator*=(const float& num)
-{
-	return *this = *this * num;
-}
-
-bool LibMath::Matrix4::operator==(const Matrix4 matrixB) const
-{
-	// Check equality via epsilon test
-	float difference = 0.0f;
-
-	for (int i = 0; i < 16; ++i)
-	{
-		float num1 = LibMath::absolute(m_matrix[i / 4][i % 4]);
-		float num2 = LibMath::absolute(matrixB.m_matrix[i / 4][i % 4]);
-
-		float scaledEpsilon = FLT_EPSILON * LibMath::max(num1, num2);
-
-		if (difference > scaledEpsilon)
-			return false;
-	}
-
-	return true;
-}
-
-bool LibMath::Matrix4::operator!=(const Matrix4 matrixB) const
-{
-	// Check equality via epsilon test
-	float difference = 0.0f;
-
-	for (int i = 0; i < 16; ++i)
-	{
-		float num1 = LibMath::absolute(m_matrix[i / 4][i % 4]);
-		float num2 = LibMath::absolute(matrixB.m_matrix[i / 4][i % 4]);
-
-		float scaledEpsilon = FLT_EPSILON * LibMath::max(num1, num2);
-
-		if (difference <= scaledEpsilon)
-			return false;
-	}
-
-	return true;
-}
-
 void LibMath::Matrix4::SwapRows(float matrix[4][4], int row1, int row2) const
 {
 	for (int i = 0; i < 4; ++i)
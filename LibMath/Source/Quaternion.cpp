@@ -0,0 +1,66 @@
+#include <cmath>
+#include <sstream>
+
+#include "Quaternion.h"
+
+LibMath::Quaternion::Quaternion(Radian angle, Vector3 const& axis)
+{
+	// Rotation of angle around axis is (sin(angle / 2) * axis, cos(angle / 2))
+	const Vector3	normalizedAxis = axis.normalizedCopy();
+	const float		halfAngle = angle.raw() * 0.5F;
+	const float		sinHalf = sinf(halfAngle);
+
+	m_x = normalizedAxis.m_x * sinHalf;
+	m_y = normalizedAxis.m_y * sinHalf;
+	m_z = normalizedAxis.m_z * sinHalf;
+	m_w = cosf(halfAngle);
+}
+
+std::string LibMath::Quaternion::string() const
+{
+	std::stringstream quaternionString;
+
+	quaternionString << '{' << m_x << ',' << m_y << ',' << m_z << ',' << m_w << '}';
+
+	return quaternionString.str();
+}
+
+LibMath::Quaternion LibMath::nlerp(Quaternion const& from, Quaternion const& to, float ratio)
+{
+	// Go through the shortest path, q & -q are the same rotation
+	Quaternion target = from.dot(to) < 0.F ? -to : to;
+
+	return (from * (1.F - ratio) + target * ratio).normalizedCopy();
+}
+
+LibMath::Quaternion LibMath::slerp(Quaternion const& from, Quaternion const& to, float ratio)
+{
+	float		cosTheta = from.dot(to);
+	Quaternion	target = to;
+
+	// Go through the shortest path, q & -q are the same rotation
+	if (cosTheta < 0.F)
+	{
+		target = -to;
+		cosTheta = -cosTheta;
+	}
+
+	// Quaternions almost aligned, sin(theta) tends to 0 so fall back to nlerp
+	if (cosTheta > 0.9995F)
+		return nlerp(from, target, ratio);
+
+	const float theta = acosf(cosTheta);
+	const float sinTheta = sinf(theta);
+
+	const float fromFactor = sinf((1.F - ratio) * theta) / sinTheta;
+	const float toFactor = sinf(ratio * theta) / sinTheta;
+
+	return from * fromFactor + target * toFactor;
+}
+
+std::ostream& LibMath::operator<<(std::ostream& os, Quaternion const& quaternion)
+{
+	os << quaternion.string();
+
+	return os;
+}
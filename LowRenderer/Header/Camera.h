@@ -56,6 +56,10 @@ public:
 
 	Frustum			 CameraFrustum(float aspect, float near, float far);
 
+	// Level snapshot, position & rotation
+	void			 SaveState(SnapshotBuffer& buffer) const override;
+	bool			 LoadState(SnapshotBuffer& buffer) override;
+
 
 	LibMath::Matrix4  m_viewProjection;
 
@@ -29,6 +29,10 @@ public:
 	// Update shader function
 	virtual void	SetUniforms(Shader& program) = 0;
 
+	// Level snapshot, light volumes switch lights on & off
+	void	SaveState(SnapshotBuffer& buffer) const override;
+	bool	LoadState(SnapshotBuffer& buffer) override;
+
 	LibMath::Vector4	m_diffuseColor;
 	LibMath::Vector4	m_ambientColor;
 	LibMath::Vector4	m_specularColor;
@@ -47,6 +51,10 @@ public:
 			PointLight(const std::string&) { /*m_index = m_active++;*/ }
 			PointLight(const PointLight& other);
 
+	// Pooled allocation
+	static void*	operator new(size_t size) { return SlabAllocator<PointLight>::New(size); }
+	static void	operator delete(void* ptr, size_t size) { SlabAllocator<PointLight>::Delete(ptr, size); }
+
 	// Initializer functions
 	void	InitPointLight(LibMath::Vector3 const& position, LibMath::Vector4 const& color);
 	void	InitPointLight(
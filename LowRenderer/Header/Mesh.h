@@ -17,6 +17,10 @@ public:
 	// Destructor
 			~Mesh(void) override;
 
+	// Pooled allocation, a level holds hundreds of meshes
+	static void*	operator new(size_t size) { return SlabAllocator<Mesh>::New(size); }
+	static void	operator delete(void* ptr, size_t size) { SlabAllocator<Mesh>::Delete(ptr, size); }
+
 	void    LinkToNode(SceneNode* node) override;
 
 	// Mesh UI Component
@@ -50,6 +54,4 @@ public:
 	Material*           m_material = nullptr;
 };
 
-void AddMeshesToUI(Graph<SceneNode>& graph, std::vector<Mesh*>& meshes);
-
-void MeshNodeUI(SceneNode* node, std::vector<Mesh*>& meshes);
\ No newline at end of file
+void AddMeshesToUI(const SceneComponents& components, std::vector<Mesh*>& meshes);
\ No newline at end of file
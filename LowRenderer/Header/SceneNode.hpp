@@ -1,8 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "Node.h"
 #include "Graph.hpp"
+#include "SlabAllocator.hpp"
+#include "SnapshotBuffer.hpp"
 
+// Object type tag, per-frame code switches on it & static_casts instead of dynamic_cast
+// MESH: Mesh, LIGHT: BaseLight, CAMERA: Camera, PLAYER: Player, COLOR_BLOCK: ColorBlock, DOOR: Door
 enum OBJECT_TYPE
 {
 	MESH,
@@ -15,6 +22,7 @@ enum OBJECT_TYPE
 
 // Forward class declaration
 class SceneNode;
+class SceneComponents;
 
 // Interface for scene objects
 class ISceneObject
@@ -28,7 +36,20 @@ public:
 
 	virtual void LinkToNode(SceneNode* node) {}
 
-	OBJECT_TYPE m_type = MESH;
+	// Gameplay state kept by a level snapshot, objects with state that changes while playing override both
+	virtual void SaveState(SnapshotBuffer& /*buffer*/) const {}
+	// Return false if the buffer ran out before the whole state was read
+	virtual bool LoadState(SnapshotBuffer& /*buffer*/) { return true; }
+
+	// Objects added to a graph can be referenced through Handle
+	using HandleRoot = ISceneObject;
+
+	OBJECT_TYPE					m_type = MESH;
+	HandleOwner<ISceneObject>	m_handle;
+
+	// Slot in the per type arrays of a SceneComponents, if the object was added to one
+	SceneComponents*			m_components = nullptr;
+	uint32_t					m_componentIndex = 0;
 };
 
 class SceneNode : public Node
@@ -50,37 +71,130 @@ public:
 	}
 
 
-	// Destructor
-	~SceneNode(void)
+	// Destructor, children are deleted by ~Node
+	~SceneNode(void);
+
+	// Scene nodes are pooled, see SlabAllocator
+	static void*	operator new(size_t size) { return SlabAllocator<SceneNode>::New(size); }
+	static void	operator delete(void* ptr, size_t size) { SlabAllocator<SceneNode>::Delete(ptr, size); }
+
+	ISceneObject* m_object = nullptr;
+};
+
+// Dense per type arrays of the scene objects & their nodes, so systems only go through
+// the objects they use (drawing meshes, lighting lights...) instead of walking the whole graph
+class SceneComponents
+{
+public:
+	struct Entry
+	{
+		ISceneObject*	m_object;
+		SceneNode*		m_node;
+	};
+
+	static constexpr size_t typeCount = DOOR + 1;
+
+	SceneComponents(void) = default;
+	SceneComponents(const SceneComponents&) = delete;
+	SceneComponents& operator=(const SceneComponents&) = delete;
+
+	~SceneComponents(void)
+	{
+		Clear();
+	}
+
+	// Fill arrays with every object of the graph, in depth first order like the old scene walk
+	void Build(Graph<SceneNode>& graph)
+	{
+		Clear();
+
+		for (SceneNode* node : graph.PreOrder())
+			Add(node);
+	}
+
+	void Add(SceneNode* node)
+	{
+		ISceneObject* object = node->m_object;
+
+		// Skip empty nodes & objects already in an array
+		if (!object || object->m_components)
+			return;
+
+		std::vector<Entry>& array = m_arrays[object->m_type];
+
+		object->m_components = this;
+		object->m_componentIndex = (uint32_t) array.size();
+
+		array.push_back({ object, node });
+	}
+
+	// Swap with the last entry, order of an array is not kept
+	void Remove(ISceneObject* object)
 	{
-		// Check object is not a null pointer
-		if (m_object)
-			delete m_object;
+		if (object->m_components != this)
+			return;
+
+		std::vector<Entry>& array = m_arrays[object->m_type];
 
-		// Delete all child nodes
-		for (Node* child : m_children)
+		array[object->m_componentIndex] = array.back();
+		array[object->m_componentIndex].m_object->m_componentIndex = object->m_componentIndex;
+		array.pop_back();
+
+		object->m_components = nullptr;
+	}
+
+	void Clear(void)
+	{
+		for (std::vector<Entry>& array : m_arrays)
 		{
-			if (child)
-			{
-				SceneNode* castChild = dynamic_cast<SceneNode*>(child);
+			for (Entry& entry : array)
+				entry.m_object->m_components = nullptr;
 
-				castChild->~SceneNode();
-				delete child;
-			}
+			array.clear();
 		}
+	}
+
+	const std::vector<Entry>& Of(OBJECT_TYPE type) const
+	{
+		return m_arrays[type];
+	}
 
-		m_children.~vector();
+	// Call func(Tobj*, SceneNode*) on every object of a type, Tobj must match the type tag
+	template<class Tobj, class Tfunc>
+	void ForEach(OBJECT_TYPE type, Tfunc&& func) const
+	{
+		for (const Entry& entry : m_arrays[type])
+			func(static_cast<Tobj*>(entry.m_object), entry.m_node);
 	}
 
-	ISceneObject* m_object = nullptr;
+private:
+	std::vector<Entry>	m_arrays[typeCount];
 };
 
+inline SceneNode::~SceneNode(void)
+{
+	// Check object is not a null pointer
+	if (m_object)
+	{
+		if (m_object->m_components)
+			m_object->m_components->Remove(m_object);
+
+		delete m_object;
+	}
+}
+
 
 template<class Tobj>
-Tobj* GetObject(Graph<SceneNode>& graph, std::string key)
+Tobj* GetObject(Graph<SceneNode>& graph, Key key)
 {
 	// Get object node
 	ISceneObject* obj = graph.GetNode(key)->m_object;
 
 	return dynamic_cast<Tobj*>(obj);
+}
+
+template<class Tobj>
+Tobj* GetObject(Graph<SceneNode>& graph, const std::string& key)
+{
+	return GetObject<Tobj>(graph, Key(key));
 }
\ No newline at end of file
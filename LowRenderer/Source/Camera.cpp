@@ -4,6 +4,7 @@
 #include "imgui/imgui_impl_opengl3.h"
 #include "imgui/imgui_impl_glfw.h"
 
+#include <LibMath/FastMath.h>
 #include <LibMath/Matrix/Matrix3.h>
 #include <LibMath/Matrix/Matrix4.h>
 #include <LibMath/Vector/Vector2.h>
@@ -153,26 +154,16 @@ void Camera::UpdateCamera(Application& window, Shader* shader, Mesh& mesh)
 	LibMath::Matrix4 projection = GetProjectionMatrix(screenSize, 0.1f, 100.0f);
 	LibMath::Matrix4 view = GetViewMatrix();
 
-	// Calculate the MVP (model view projection) matrix
-	LibMath::Matrix4 mvp = mesh.m_sceneNode->m_globalTransform * view * projection;
+	// Calculate the MVP (model view projection) matrix, quantized models add their position decode
+	LibMath::Matrix4 model = mesh.m_model ? mesh.m_model->DrawTransform(mesh.m_sceneNode->GetGlobalTransform())
+										  : mesh.m_sceneNode->GetGlobalTransform();
+	LibMath::Matrix4 mvp = model * view * projection;
 
 	//  Update the data for the view, projection & model 4x4 matrices inside the vertex shader
 
-	LibMath::Matrix4 normalMat4 = mesh.m_sceneNode->m_globalTransform.GetInverse();
-	normalMat4.Transpose(normalMat4);
-
-	float normalMatArray[] =
-	{
-		normalMat4.m_matrix[0][0], normalMat4.m_matrix[0][1], normalMat4.m_matrix[0][2],
-		normalMat4.m_matrix[1][0], normalMat4.m_matrix[1][1], normalMat4.m_matrix[1][2],
-		normalMat4.m_matrix[2][0], normalMat4.m_matrix[2][1], normalMat4.m_matrix[2][2]
-	};
-
-	LibMath::Matrix3 normalMat3(normalMatArray);
-
-	shader->SetUniform("model", mesh.m_sceneNode->m_globalTransform);
+	shader->SetUniform("model", model);
 	shader->SetUniform("mvp", mvp);
-	shader->SetUniform("normalMat", normalMat3);
+	shader->SetUniform("normalMat", mesh.m_sceneNode->GetNormalMatrix());
 }
 
 
@@ -202,8 +193,8 @@ LibMath::Matrix4 Camera::GetViewMatrix(void) const
 {
 	// Calculate vectors for look at matrix
 	const LibMath::Vector3 center = m_position + m_front;
-	const LibMath::Vector3 forward = (center - m_position).normalizedCopy();
-	const LibMath::Vector3 right = (forward.cross(m_up)).normalizedCopy();
+	const LibMath::Vector3 forward = LibMath::Fast::normalizedCopy(center - m_position);
+	const LibMath::Vector3 right = LibMath::Fast::normalizedCopy(forward.cross(m_up));
 	const LibMath::Vector3 up = right.cross(forward);
 
 	/*
@@ -235,8 +226,8 @@ LibMath::Matrix4 Camera::GetProjectionMatrix(const LibMath::Vector2& screenSize,
 Frustum Camera::CameraFrustum(float aspect, float near, float far)
 {
 	const LibMath::Vector3 center = m_position + m_front;
-	const LibMath::Vector3 forward = (center - m_position).normalizedCopy();
-	const LibMath::Vector3 right = (forward.cross(m_up)).normalizedCopy();
+	const LibMath::Vector3 forward = LibMath::Fast::normalizedCopy(center - m_position);
+	const LibMath::Vector3 right = LibMath::Fast::normalizedCopy(forward.cross(m_up));
 	const LibMath::Vector3 up = right.cross(forward);
 
 	float halfFarHeight = far * tanf(m_fov * 0.5f);
@@ -308,13 +299,37 @@ void Camera::UpdateVectors()
 	// Update camera vectors
 	LibMath::Vector3 front = {0.0f, 0.0f, 0.0f};
 
+	// Fast trig & normalize are enough here, vectors are rebuilt from the angles every time
+	float yawSine, yawCosine, pitchSine, pitchCosine;
+
+	LibMath::Fast::sinCos(m_yaw * (M_PI / 180.0f), yawSine, yawCosine);
+	LibMath::Fast::sinCos(m_pitch * (M_PI / 180.0f), pitchSine, pitchCosine);
+
 	// Update front vector relative to the camera's current transformation
-	front.m_x = cosf(m_yaw * (M_PI / 180.0f)) * cosf(m_pitch * (M_PI / 180.0f));
-	front.m_y = sinf(m_pitch * (M_PI / 180.0f));
-	front.m_z = sinf(m_yaw * (M_PI / 180.0f)) * cosf(m_pitch * (M_PI / 180.0f));
+	front.m_x = yawCosine * pitchCosine;
+	front.m_y = pitchSine;
+	front.m_z = yawSine * pitchCosine;
 
 	// Update & normalize all vectors via the updated front vector
-	m_front = front.normalizedCopy();
-	m_right = (m_front.cross({0.0f, 1.0f, 0.0f})).normalizedCopy();
-	m_up = (m_right.cross(m_front)).normalizedCopy();
-}
\ No newline at end of file
+	m_front = LibMath::Fast::normalizedCopy(front);
+	m_right = LibMath::Fast::normalizedCopy(m_front.cross({0.0f, 1.0f, 0.0f}));
+	m_up = LibMath::Fast::normalizedCopy(m_right.cross(m_front));
+}
+
+// Save position & angles, direction vectors are rebuilt from the angles
+void Camera::SaveState(SnapshotBuffer& buffer) const
+{
+	buffer.Write(m_position);
+	buffer.Write(m_yaw);
+	buffer.Write(m_pitch);
+}
+
+bool Camera::LoadState(SnapshotBuffer& buffer)
+{
+	if (!(buffer.Read(m_position) && buffer.Read(m_yaw) && buffer.Read(m_pitch)))
+		return false;
+
+	UpdateVectors();
+
+	return true;
+}
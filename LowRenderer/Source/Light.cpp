@@ -59,6 +59,16 @@ void BaseLight::SetAttenuation(float constant, float linear, float quadratic)
 	m_attenuation = { constant, linear, quadratic };
 }
 
+void BaseLight::SaveState(SnapshotBuffer& buffer) const
+{
+	buffer.Write(m_enabled);
+}
+
+bool BaseLight::LoadState(SnapshotBuffer& buffer)
+{
+	return buffer.Read(m_enabled);
+}
+
 // Point light copy constructor
 PointLight::PointLight(const PointLight& other)
 {
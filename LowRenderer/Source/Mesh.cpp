@@ -46,26 +46,11 @@ void Mesh::SetPosition(float x, float y, float z)
 
 void Mesh::Translate(const LibMath::Vector3& translate)
 {
-	// Apply translation to mesh
-
+	// Apply translation to mesh, local matrix is rebuilt on the next graph update
 	if (m_sceneNode)
 	{
-		// Initialize a 4x4 matrix to all zeros
-		LibMath::Matrix4 translationMatrix;
-
-		// Convert to identity matrix
-		translationMatrix.m_matrix[0][0] = 1.0f;
-		translationMatrix.m_matrix[1][1] = 1.0f;
-		translationMatrix.m_matrix[2][2] = 1.0f;
-
-		translationMatrix.m_matrix[3][0] = translate[0];
-		translationMatrix.m_matrix[3][1] = translate[1];
-		translationMatrix.m_matrix[3][2] = translate[2];
-		translationMatrix.m_matrix[3][3] = 1.f;
-
-		// Apply translation
-		m_sceneNode->m_localTransform = translationMatrix * m_sceneNode->m_localTransform;
-		m_sceneNode->m_dirty = true;
+		m_sceneNode->m_translation += translate;
+		m_sceneNode->MarkDirty();
 	}
 
 	m_position += translate;
@@ -77,38 +62,11 @@ void Mesh::Rotate(const float& angle, const LibMath::Vector3& axis)
 
 	if (m_sceneNode)
 	{
+		// Compose in object space, renormalize so repeated rotations do not drift
+		LibMath::Quaternion rotation(LibMath::Radian(angle), axis);
 
-		// Initialize 4x4 matrix to all zeros
-		LibMath::Matrix4			rotationMatrix;
-
-		// Store return values as variables in order to prevent multiple function calls
-		const LibMath::Vector3		normalizedAxis = axis.normalizedCopy();
-		const float					oneMinCos = 1.0f - cosf(angle);
-		const float					cosAngle = cosf(angle);
-		const float					sinAngle = sinf(angle);
-
-		// Rotation matrix line one
-		rotationMatrix.m_matrix[0][0] = cosAngle + LibMath::power(normalizedAxis.m_x, 2) * oneMinCos;
-		rotationMatrix.m_matrix[1][0] = normalizedAxis.m_x * normalizedAxis.m_y * oneMinCos - normalizedAxis.m_z * sinAngle;
-		rotationMatrix.m_matrix[2][0] = normalizedAxis.m_x * normalizedAxis.m_z * oneMinCos + normalizedAxis.m_y * sinAngle;
-
-		// Rotation matrix line two
-		rotationMatrix.m_matrix[0][1] = normalizedAxis.m_y * normalizedAxis.m_x * oneMinCos + normalizedAxis.m_z * sinAngle;
-		rotationMatrix.m_matrix[1][1] = cosAngle + LibMath::power(normalizedAxis.m_y, 2) * oneMinCos;
-		rotationMatrix.m_matrix[2][1] = normalizedAxis.m_y * normalizedAxis.m_z * oneMinCos - normalizedAxis.m_x * sinAngle;
-
-		// Rotation matrix line three
-		rotationMatrix.m_matrix[0][2] = normalizedAxis.m_z * normalizedAxis.m_x * oneMinCos - normalizedAxis.m_y * sinAngle;
-		rotationMatrix.m_matrix[1][2] = normalizedAxis.m_z * normalizedAxis.m_y * oneMinCos + normalizedAxis.m_x * sinAngle;
-		rotationMatrix.m_matrix[2][2] = cosAngle + LibMath::power(normalizedAxis.m_z, 2) * oneMinCos;
-
-		// Rotation matrix line four
-		rotationMatrix.m_matrix[3][3] = 1.0f;
-
-
-		m_sceneNode->m_localTransform = rotationMatrix * m_sceneNode->m_localTransform;
-
-		m_sceneNode->m_dirty = true;
+		m_sceneNode->m_rotation = (m_sceneNode->m_rotation * rotation).normalizedCopy();
+		m_sceneNode->MarkDirty();
 	}
 
 }
@@ -118,20 +76,8 @@ void Mesh::Scale(const LibMath::Vector3& scale)
 	// Apply a scale transformation
 	if (m_sceneNode)
 	{
-		// Initialize 4x4 matrix
-		LibMath::Matrix4 scalingMatrix;
-
-		// Initialize matrix value to given scale x, y, z components
-		scalingMatrix.m_matrix[0][0] = scale[0];
-		scalingMatrix.m_matrix[1][1] = scale[1];
-		scalingMatrix.m_matrix[2][2] = scale[2];
-		scalingMatrix.m_matrix[3][3] = 1.f;
-
-		// Apply translation
-
-		m_sceneNode->m_localTransform = scalingMatrix * m_sceneNode->m_localTransform;
-
-		m_sceneNode->m_dirty = true;
+		m_sceneNode->m_scale *= scale;
+		m_sceneNode->MarkDirty();
 	}
 
 	m_scale = scale;
@@ -176,31 +122,7 @@ void Mesh::CreateModelVAO()
 }
 
 
-void AddMeshesToUI(Graph<SceneNode>& graph, std::vector<Mesh*>& meshes)
+void AddMeshesToUI(const SceneComponents& components, std::vector<Mesh*>& meshes)
 {
-	for (SceneNode* node : graph.m_worldRoot->m_children)
-		MeshNodeUI(node, meshes);
-}
-
-void MeshNodeUI(SceneNode* node, std::vector<Mesh*>& meshes)
-{
-	if (node->m_object->m_type == MESH)
-	{
-		Mesh* mesh = dynamic_cast<Mesh*>(node->m_object);
-
-		if (!mesh)
-			return;
-
-		meshes.push_back(mesh);
-	}
-
-	for (Node* child : node->m_children)
-	{
-		SceneNode* sceneChild = dynamic_cast<SceneNode*>(child);
-
-		if (!sceneChild)
-			return;
-
-		MeshNodeUI(sceneChild, meshes);
-	}
+	components.ForEach<Mesh>(MESH, [&meshes](Mesh* mesh, SceneNode*) { meshes.push_back(mesh); });
 }
\ No newline at end of file
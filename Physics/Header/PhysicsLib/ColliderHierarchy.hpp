@@ -3,10 +3,31 @@
 #include "Graph.hpp"
 #include "Node.h"
 #include "CollisionDetection.h"
+#include "DynamicAABBTree.h"
+#include "FrustumCuller.h"
+#include "SpatialHashGrid.h"
+#include "SweepAndPrune.h"
 
 #include "Frustum.h"
 
+class Ray;
+
+// Structure the broad phase finds colliders near a volume with
+enum class BroadphaseType
+{
+	// Dynamic AABB tree, any collider sizes (see DynamicAABBTree)
+	TREE,
+
+	// Hashed uniform grid, many colliders of about a cell wide (see SpatialHashGrid)
+	GRID,
+
+	// Sorted endpoints & persistent overlapping pairs, cheap moves but linear queries (see SweepAndPrune)
+	SWEEP_AND_PRUNE
+};
+
 // Collider graph container for broad phase sweeping and easier updates
+// Childless nodes are the colliders, they are also kept in a broad phase structure queried by the broad phase
+// Parent nodes only group colliders, where they are placed does not change query results
 class BVHierarchy
 {
 public:
@@ -15,53 +36,142 @@ public:
 	BVHierarchy(void) = default;
 	~BVHierarchy(void) = default;
 
+	// Create empty hierarchy with a broad phase structure
+	explicit BVHierarchy(BroadphaseType broadphase)
+		: m_broadphase(broadphase)
+	{}
+
+	class BVNode;
+
 	// Add a collider of any typo into graph with a parent
 	template <typename Tobj, typename... TArgs>
-	Tobj* AddCollider(const std::string parentKey, const std::string key, const TArgs&... args)
+	Tobj* AddCollider(Key parentKey, Key key, const TArgs&... args)
 	{
-		return m_hierarchy.AddChild<Tobj>(parentKey, key, args...);
+		Tobj* collider = m_hierarchy.AddChild<Tobj>(parentKey, key, args...);
+
+		AddProxy(m_hierarchy.GetNode(key));
+		m_bakeDirty = true;
+
+		return collider;
+	}
+
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddCollider(const std::string& parentKey, const std::string& key, const TArgs&... args)
+	{
+		return AddCollider<Tobj>(Key(parentKey), Key(key), args...);
 	}
 
 
 	// Add a collider of any type into graph without a parent
 	template <typename Tobj, typename... TArgs>
-	Tobj* AddCollider(const std::string key, const TArgs&... args)
+	Tobj* AddCollider(Key key, const TArgs&... args)
+	{
+		Tobj* collider = m_hierarchy.AddChild<Tobj>(key, args...);
+
+		AddProxy(m_hierarchy.GetNode(key));
+		m_bakeDirty = true;
+
+		return collider;
+	}
+
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddCollider(const std::string& key, const TArgs&... args)
+	{
+		return AddCollider<Tobj>(Key(key), args...);
+	}
+
+
+	// Add a collider that never moves, refit once when baked instead of every update
+	// Its box & scene node must be set before the first update, or MarkStaticDirty called after
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddStaticCollider(Key parentKey, Key key, const TArgs&... args)
+	{
+		Tobj* collider = AddCollider<Tobj>(parentKey, key, args...);
+
+		m_hierarchy.GetNode(key)->m_static = true;
+
+		return collider;
+	}
+
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddStaticCollider(const std::string& parentKey, const std::string& key, const TArgs&... args)
+	{
+		return AddStaticCollider<Tobj>(Key(parentKey), Key(key), args...);
+	}
+
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddStaticCollider(Key key, const TArgs&... args)
+	{
+		Tobj* collider = AddCollider<Tobj>(key, args...);
+
+		m_hierarchy.GetNode(key)->m_static = true;
+
+		return collider;
+	}
+
+	template <typename Tobj, typename... TArgs>
+	Tobj* AddStaticCollider(const std::string& key, const TArgs&... args)
 	{
-		return m_hierarchy.AddChild<Tobj>(key, args...);
+		return AddStaticCollider<Tobj>(Key(key), args...);
 	}
 
 
-	// Delete a collider from graph
-	void DeleteCollider(const std::string key)
+	// Delete a collider from graph, a parent left without children becomes a collider again
+	void DeleteCollider(Key key);
+
+	void DeleteCollider(const std::string& key)
 	{
-		m_hierarchy.DeleteNode(key);
+		DeleteCollider(Key(key));
 	}
 
 	// Save mesh scene node associated with collider
 	template<class NodeT>
-	void LinkToNode(Graph<NodeT>& graph, const std::string colliderKey, const std::string sceneNodeKey);
+	void LinkToNode(Graph<NodeT>& graph, Key colliderKey, Key sceneNodeKey);
 
-	// Update entire hierarchy
-	void Update()
+	template<class NodeT>
+	void LinkToNode(Graph<NodeT>& graph, const std::string& colliderKey, const std::string& sceneNodeKey)
 	{
-		m_hierarchy.UpdateGraph();
+		LinkToNode(graph, Key(colliderKey), Key(sceneNodeKey));
 	}
 
-	// Update entire hierarchy with frustum culling
-	void Update(const Frustum& frustum)
+	// Refit dynamic colliders, static ones are only refit when baked
+	void Update();
+
+	// Refit dynamic colliders with frustum culling, static ones only have their mesh culled
+	void Update(const Frustum& frustum);
+
+	// Refit & bake static colliders again on the next update, after they were moved by hand
+	void MarkStaticDirty(void)
 	{
-		// Iterate through root children and recursively update graph
-		for (BVNode* node : m_hierarchy.m_worldRoot->m_children)
-		{
-			node->Update(frustum);
-		}
+		m_bakeDirty = true;
+	}
+
+	// Refit every collider & rebuild the tree with a SAH split (grids only refit), call once a level is loaded
+	// Linked scene nodes must be updated first, boxes are fit to their global transforms
+	void BuildBroadphase(void);
+
+	// Switch broad phase structure, colliders already added are moved to the new one
+	void SetBroadphase(BroadphaseType broadphase);
+
+	BroadphaseType GetBroadphase(void) const
+	{
+		return m_broadphase;
 	}
 
+	// Fill result with the colliders whose broad phase box overlaps target, cleared first so it can be reused every frame
+	// Colliders are not tested themselves
+	void QueryColliders(Collider* target, std::vector<BVNode*>& result);
+
+	// Fill result with the colliders whose broad phase box a ray hits, cleared first
+	void QueryColliders(const Ray& ray, std::vector<BVNode*>& result);
+
 	// Collider node class
 	class BVNode
 	{
 	public:
 
+		using HandleRoot = BVNode;
+
 		// Constructors
 		BVNode(void) = default;
 		BVNode(BVNode* parent, Collider* collider);
@@ -69,10 +179,14 @@ public:
 		// Destructor
 		~BVNode(void);
 
-		// Update collider with frustum culling
+		// Pooled allocation, one node per collider
+		static void*	operator new(size_t size) { return SlabAllocator<BVNode>::New(size); }
+		static void	operator delete(void* ptr, size_t size) { SlabAllocator<BVNode>::Delete(ptr, size); }
+
+		// Update this collider with frustum culling, children are not updated
 		void Update(const Frustum& frustum);
 
-		// Update collider
+		// Update this collider, children are not updated
 		void Update();
 
 		// Update AABB
@@ -87,14 +201,29 @@ public:
 		// Test collision with any collider type
 		bool TestCollision(Collider* target);
 
-		// Sweep and prune colliders
-		void PruneColliders(Collider* target, std::vector<BVHierarchy::BVNode*>& prunedList, BVHierarchy::BVNode* collider);
+		// Move the broad phase box to the collider, if this node is in the broad phase
+		void UpdateProxy();
+
+		// Take this node out of the broad phase, when it becomes a parent
+		void RemoveProxy();
 
 
 		std::vector<BVNode*>	m_children;
 		BVNode*					m_parent = nullptr;
-		Node*					m_sceneNode = nullptr;
+		// Key in the graph, position in the parent's children & in the graph's pre-order, set by Graph
+		Key						m_key;
+		uint32_t				m_childIndex = 0;
+		uint32_t				m_orderIndex = 0;
+		Handle<Node>			m_sceneNode;
 		Collider*				m_collider = nullptr;
+		HandleOwner<BVNode>		m_handle;
+
+		// Broad phase proxy of a childless node, set by BVHierarchy
+		BVHierarchy*			m_owner = nullptr;
+		int32_t					m_proxy = -1;
+
+		// Never refit after baking, see AddStaticCollider
+		bool					m_static = false;
 
 
 	private:
@@ -113,13 +242,66 @@ public:
 	};
 
 
-	Graph<BVNode>			m_hierarchy;
+	// Generational handle to a collider node
+	Handle<BVNode> GetHandle(Key key)
+	{
+		return m_hierarchy.GetHandle(key);
+	}
+
+	// Declared first so nodes can still remove their proxies when the graph is destroyed
+	PhysicsLib::DynamicAABBTree		m_tree;
+	PhysicsLib::SpatialHashGrid		m_grid;
+	PhysicsLib::SweepAndPrune		m_sweep;
+
+	Graph<BVNode>					m_hierarchy;
+
+private:
+
+	// Put a new collider in the broad phase in place of its parent
+	void AddProxy(BVNode* node);
+
+	// Create, refit & destroy a node's proxy in the current broad phase structure
+	void CreateProxy(BVNode* node);
+	void MoveProxy(BVNode* node);
+	void DestroyProxy(BVNode* node);
+
+	// Refit every collider, then split them into the dynamic list & the static culling arrays
+	void Bake(void);
+
+	// Call func with the current broad phase structure, they share the same proxy interface
+	template<typename TFunc>
+	decltype(auto) WithBroadphase(TFunc func)
+	{
+		switch (m_broadphase)
+		{
+		case BroadphaseType::GRID:
+			return func(m_grid);
+
+		case BroadphaseType::SWEEP_AND_PRUNE:
+			return func(m_sweep);
+
+		default:
+			return func(m_tree);
+		}
+	}
+
+	BroadphaseType					m_broadphase = BroadphaseType::TREE;
+
+	// Colliders refit every update, in pre-order
+	std::vector<BVNode*>			m_dynamicNodes;
+
+	// Baked static boxes linked to a scene node & their nodes in the same order, read only until the next bake
+	PhysicsLib::FrustumCuller		m_staticCuller;
+	std::vector<Handle<Node>>		m_staticSceneNodes;
+
+	// Colliders were added, deleted or marked dirty since the last bake
+	bool							m_bakeDirty = true;
 
 };
 
 // Store scene node address in BVNode
 template<class NodeT>
-void BVHierarchy::LinkToNode(Graph<NodeT>& graph, const std::string colliderKey, const std::string sceneNodeKey)
+void BVHierarchy::LinkToNode(Graph<NodeT>& graph, Key colliderKey, Key sceneNodeKey)
 {
 	BVNode* node = m_hierarchy.GetNode(colliderKey);
 
@@ -131,9 +313,15 @@ void BVHierarchy::LinkToNode(Graph<NodeT>& graph, const std::string colliderKey,
 
 // Get cast collider from collider hierarchy
 template<class Tobj>
-Tobj* GetObject(Graph<BVHierarchy::BVNode>& graph, std::string key)
+Tobj* GetObject(Graph<BVHierarchy::BVNode>& graph, Key key)
 {
 	Collider* obj = graph.GetNode(key)->m_collider;
 
 	return dynamic_cast<Tobj*>(obj);
+}
+
+template<class Tobj>
+Tobj* GetObject(Graph<BVHierarchy::BVNode>& graph, const std::string& key)
+{
+	return GetObject<Tobj>(graph, Key(key));
 }
\ No newline at end of file
@@ -2,13 +2,18 @@
 
 #include "LibMath/Vector/Vector3.h"
 
+#include "Handle.hpp"
+#include "SlabAllocator.hpp"
+
 // Forward declaration of color class
 class Color;
 
 // Create namespace to easily identify physics classes
 namespace PhysicsLib
 {
-	// Store collider types
+	// Store collider types, a type check allows a static_cast to the matching class:
+	// SPHERE: SphereCollider, COLOR_CUBE: ColoredBoxCollider, HOLED: HoledCollider,
+	// TELEPORTER: Teleporter, LIGHT_BOX: LightBox, any other type: BoxCollider
 	enum COLLIDER_TYPE
 	{
 		BOX,
@@ -32,7 +37,11 @@ namespace PhysicsLib
 		// Destructor
 		virtual ~ICollider(void) = default;
 
-		COLLIDER_TYPE m_type = SPHERE;
+		// Colliders added to a BVHierarchy can be referenced through Handle
+		using HandleRoot = ICollider;
+
+		COLLIDER_TYPE				m_type = SPHERE;
+		HandleOwner<ICollider>		m_handle;
 	};
 
 	// Forward declaration of SphereCollider class
@@ -49,6 +58,10 @@ namespace PhysicsLib
 		// Destructor
 		virtual ~BoxCollider() override = default;
 
+		// Level colliders are pooled per type, see SlabAllocator
+		static void*	operator new(size_t size) { return SlabAllocator<BoxCollider>::New(size); }
+		static void	operator delete(void* ptr, size_t size) { SlabAllocator<BoxCollider>::Delete(ptr, size); }
+
 		// Update collider transform
 		void	SetColliderTransform(LibMath::Vector3 const& position, LibMath::Vector3 const& boxScale);
 
@@ -77,6 +90,10 @@ namespace PhysicsLib
 		// Destructor
 		virtual ~SphereCollider(void) override = default;
 
+		// Pooled allocation
+		static void*	operator new(size_t size) { return SlabAllocator<SphereCollider>::New(size); }
+		static void	operator delete(void* ptr, size_t size) { SlabAllocator<SphereCollider>::Delete(ptr, size); }
+
 		// Setter
 		void	SetColliderPosition(LibMath::Vector3 const& position);
 
@@ -101,6 +118,10 @@ namespace PhysicsLib
 		// Destructor
 		~ColoredBoxCollider(void) = default;
 
+		// Pooled allocation
+		static void*	operator new(size_t size) { return SlabAllocator<ColoredBoxCollider>::New(size); }
+		static void	operator delete(void* ptr, size_t size) { SlabAllocator<ColoredBoxCollider>::Delete(ptr, size); }
+
 		Color* m_color = nullptr;
 	};
 
@@ -115,7 +136,11 @@ namespace PhysicsLib
 		// Destructor
 		~HoledCollider(void) = default;
 
-		BoxCollider* m_hole = nullptr;
+		// Pooled allocation
+		static void*	operator new(size_t size) { return SlabAllocator<HoledCollider>::New(size); }
+		static void	operator delete(void* ptr, size_t size) { SlabAllocator<HoledCollider>::Delete(ptr, size); }
+
+		Handle<BoxCollider> m_hole;
 	};
 
 	// Teleporter class which inherits from Box collider class
@@ -123,13 +148,17 @@ namespace PhysicsLib
 	{
 	public:
 		// Constructor
-		Teleporter(void) { m_type = HOLED; }
+		Teleporter(void) { m_type = TELEPORTER; }
 		Teleporter(LibMath::Vector3 const& position, LibMath::Vector3 const& boxScale, COLLIDER_TYPE type = TELEPORTER);
 
 		// Destructor
 		~Teleporter(void) = default;
 
-		Teleporter* m_otherSide = nullptr;
+		// Pooled allocation
+		static void*	operator new(size_t size) { return SlabAllocator<Teleporter>::New(size); }
+		static void	operator delete(void* ptr, size_t size) { SlabAllocator<Teleporter>::Delete(ptr, size); }
+
+		Handle<Teleporter> m_otherSide;
 	};
 }
 
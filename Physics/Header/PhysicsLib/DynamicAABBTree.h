@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "LibMath/Arithmetic.h"
+#include "LibMath/Vector/Vector3.h"
+
+namespace PhysicsLib
+{
+	// Bounding volume hierarchy over axis aligned boxes, built automatically from the boxes it holds
+	// Leaves (proxies) store a fattened box & a user pointer, moving a box inside its fat box costs nothing
+	// Boxes can be inserted, removed & moved one at a time (kept balanced by rotations)
+	// or all rebuilt at once with a surface area heuristic (SAH) split
+	class DynamicAABBTree
+	{
+	public:
+
+		// Index of no node, returned for invalid proxies
+		static constexpr int32_t	nullNode = -1;
+
+		// Constructor & destructor
+		DynamicAABBTree(void) = default;
+		~DynamicAABBTree(void) = default;
+
+		// Add a box, returns a proxy id that stays valid until DestroyProxy
+		int32_t		CreateProxy(const LibMath::Vector3& min, const LibMath::Vector3& max, void* userData);
+
+		// Remove a box
+		void		DestroyProxy(int32_t proxy);
+
+		// Update a box, reinserted only if it left its fat box, returns true if it was
+		bool		MoveProxy(int32_t proxy, const LibMath::Vector3& min, const LibMath::Vector3& max);
+
+		// User pointer given to CreateProxy
+		void*		GetUserData(int32_t proxy) const { return m_nodes[proxy].m_userData; }
+
+		// Fat box of a proxy
+		const LibMath::Vector3&		GetFatMin(int32_t proxy) const { return m_nodes[proxy].m_min; }
+		const LibMath::Vector3&		GetFatMax(int32_t proxy) const { return m_nodes[proxy].m_max; }
+
+		// Rebuild every internal node top-down with binned SAH, proxy ids are kept
+		void		Build(void);
+
+		// Remove every proxy
+		void		Clear(void);
+
+		// Longest root to leaf path, 0 for a single leaf or an empty tree
+		int32_t		GetHeight(void) const { return m_root == nullNode ? 0 : m_nodes[m_root].m_height; }
+
+		int32_t		GetProxyCount(void) const { return m_proxyCount; }
+
+		// Call func(proxy) for every proxy whose fat box overlaps [min, max], return false from func to stop
+		template<typename TFunc>
+		void		Query(const LibMath::Vector3& min, const LibMath::Vector3& max, TFunc func) const;
+
+		// Call func(proxy) for every proxy whose fat box a ray hits within maxDistance, return false from func to stop
+		// inverseDir is 1 / direction, 0 on axes the ray does not move along (see Ray)
+		template<typename TFunc>
+		void		RayCast(const LibMath::Vector3& origin, const LibMath::Vector3& inverseDir, float maxDistance, TFunc func) const;
+
+		// Distance boxes are fattened by on every side
+		float		m_margin = 0.5f;
+
+	private:
+
+		struct TreeNode
+		{
+			bool	IsLeaf(void) const { return m_child1 == nullNode; }
+
+			// Fattened box for leaves, union of the children for internal nodes
+			LibMath::Vector3	m_min;
+			LibMath::Vector3	m_max;
+
+			void*				m_userData = nullptr;
+
+			// Parent while in the tree, next free node while in the free list
+			int32_t				m_parent = nullNode;
+			int32_t				m_child1 = nullNode;
+			int32_t				m_child2 = nullNode;
+
+			// Leaf = 0, free = -1
+			int32_t				m_height = -1;
+		};
+
+		int32_t		AllocateNode(void);
+		void		FreeNode(int32_t node);
+
+		void		InsertLeaf(int32_t leaf);
+		void		RemoveLeaf(int32_t leaf);
+
+		// Rotate an unbalanced node, returns the index now at its place
+		int32_t		Balance(int32_t node);
+
+		// Recompute boxes & heights from node up to the root, balancing on the way
+		void		Refit(int32_t node);
+
+		// Build a subtree over leaves[first, last), returns its root
+		int32_t		BuildRange(std::vector<int32_t>& leaves, int32_t first, int32_t last);
+
+		static bool	Overlap(const TreeNode& node, const LibMath::Vector3& min, const LibMath::Vector3& max);
+
+		std::vector<TreeNode>			m_nodes;
+		int32_t							m_root = nullNode;
+		int32_t							m_freeList = nullNode;
+		int32_t							m_proxyCount = 0;
+
+		// Traversal stack reused by queries
+		mutable std::vector<int32_t>	m_stack;
+	};
+
+	template<typename TFunc>
+	void DynamicAABBTree::Query(const LibMath::Vector3& min, const LibMath::Vector3& max, TFunc func) const
+	{
+		if (m_root == nullNode)
+			return;
+
+		m_stack.clear();
+		m_stack.push_back(m_root);
+
+		while (!m_stack.empty())
+		{
+			const int32_t	index = m_stack.back();
+			const TreeNode& node = m_nodes[index];
+
+			m_stack.pop_back();
+
+			if (!Overlap(node, min, max))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if (!func(index))
+					return;
+			}
+			else
+			{
+				m_stack.push_back(node.m_child1);
+				m_stack.push_back(node.m_child2);
+			}
+		}
+	}
+
+	template<typename TFunc>
+	void DynamicAABBTree::RayCast(const LibMath::Vector3& origin, const LibMath::Vector3& inverseDir, float maxDistance, TFunc func) const
+	{
+		if (m_root == nullNode)
+			return;
+
+		m_stack.clear();
+		m_stack.push_back(m_root);
+
+		while (!m_stack.empty())
+		{
+			const int32_t	index = m_stack.back();
+			const TreeNode& node = m_nodes[index];
+
+			m_stack.pop_back();
+
+			// Same slab test as Ray::Intersect so no box it hits is skipped, a bigger box only widens the interval
+			float	maxIntersect = 1000000.f, minIntersect = -1000000.f;
+
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				const float low = (node.m_min[axis] - origin[axis]) * inverseDir[axis];
+				const float high = (node.m_max[axis] - origin[axis]) * inverseDir[axis];
+
+				maxIntersect = LibMath::min(LibMath::max(low, high), maxIntersect);
+				minIntersect = LibMath::max(LibMath::min(low, high), minIntersect);
+			}
+
+			if (maxIntersect < LibMath::max(minIntersect, 0.f) || minIntersect > maxDistance)
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if (!func(index))
+					return;
+			}
+			else
+			{
+				m_stack.push_back(node.m_child1);
+				m_stack.push_back(node.m_child2);
+			}
+		}
+	}
+}
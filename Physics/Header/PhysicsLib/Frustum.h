@@ -37,9 +37,16 @@ public:
 	// Check if an AABB is intersecting or in front of a view frustum plane
 	bool IntersectOrForward(const BoxBV& collider) const;
 
+	// Check if an AABB given by its center and half size is intersecting or in front of the plane
+	bool IntersectOrForward(const LibMath::Vector3& center, const LibMath::Vector3& extent) const;
+
 	// Find signed distance between a plane and a point
 	float FindDistance(const LibMath::Vector3& point) const;
 
+	// Plane normal & direction, boxes are in front if normal . center + radius >= direction
+	const LibMath::Vector3&	GetNormal(void) const { return m_normal; }
+	float					GetDirection(void) const { return m_direction; }
+
 	// Default destructor
 	~Plane(void) = default;
 
@@ -67,23 +74,18 @@ public:
 	// Check intersection with AABB
 	bool	Intersect(const BoxBV& collider) const;
 
-	// Array index operators
-	Plane&	operator[](PLANE index);
-	Plane	operator[](PLANE index) const;
+	// Check intersection with AABB center and half size
+	bool	Intersect(const LibMath::Vector3& center, const LibMath::Vector3& extent) const;
+
+	// Array index operators (no bound checking)
+	Plane&			operator[](PLANE index) { return m_planes[index]; }
+	const Plane&	operator[](PLANE index) const { return m_planes[index]; }
 
 	// Copy assignment operator
 	Frustum& operator=(const Frustum& rhs);
 
 private:
 
-	// View frustum planes
-
-	Plane	m_near;
-	Plane	m_far;
-
-	Plane	m_right;
-	Plane	m_left;
-
-	Plane	m_top;
-	Plane	m_bottom;
+	// View frustum planes, indexed by PLANE
+	Plane	m_planes[6];
 };
\ No newline at end of file
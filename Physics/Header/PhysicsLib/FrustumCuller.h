@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "LibMath/Vector/Vector3.h"
+
+class Frustum;
+
+namespace PhysicsLib
+{
+	// Frustum culling over boxes that do not move, kept as structure of arrays & tested several at a time
+	// Each box remembers the plane that last rejected it & tests it first, boxes out of view often stay behind the same plane
+	class FrustumCuller
+	{
+	public:
+
+		// Constructor & destructor
+		FrustumCuller(void) = default;
+		~FrustumCuller(void) = default;
+
+		// Add a box from its center & half size, returns its index
+		// Grown by the extra leeway of Frustum::Intersect so a box is never culled when Frustum::Intersect keeps it
+		uint32_t	Add(const LibMath::Vector3& center, const LibMath::Vector3& extent);
+
+		// Remove every box
+		void		Clear(void);
+
+		size_t		GetCount(void) const { return m_centerX.size(); }
+
+		// Test every box against a frustum, returns how many may be visible
+		size_t		Cull(const Frustum& frustum);
+
+		// Result of the last Cull for a box
+		bool		IsVisible(size_t index) const
+		{
+			return (m_visible[index / 64] >> (index % 64)) & 1u;
+		}
+
+	private:
+
+		std::vector<float>		m_centerX, m_centerY, m_centerZ;
+		std::vector<float>		m_extentX, m_extentY, m_extentZ;
+
+		// Plane index that last rejected each box
+		std::vector<uint8_t>	m_lastPlanes;
+
+		// Bit per box, set if visible
+		std::vector<uint64_t>	m_visible;
+	};
+}
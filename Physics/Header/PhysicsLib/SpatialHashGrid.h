@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+#include "LibMath/Arithmetic.h"
+#include "LibMath/Vector/Vector3.h"
+
+namespace PhysicsLib
+{
+	// Uniform grid over axis aligned boxes, cells hashed into a fixed bucket table so the level needs no bounds
+	// Works best when boxes are about a cell wide, boxes covering too many cells are kept in a list tested every query
+	// Same proxy interface as DynamicAABBTree, proxies are moved between buckets only when their cell range changes
+	class SpatialHashGrid
+	{
+	public:
+
+		// Index of no proxy
+		static constexpr int32_t	nullProxy = -1;
+
+		// Constructor & destructor
+		SpatialHashGrid(void) = default;
+		SpatialHashGrid(float cellSize, uint32_t bucketCount = 4096);
+		~SpatialHashGrid(void) = default;
+
+		// Add a box, returns a proxy id that stays valid until DestroyProxy
+		int32_t		CreateProxy(const LibMath::Vector3& min, const LibMath::Vector3& max, void* userData);
+
+		// Remove a box
+		void		DestroyProxy(int32_t proxy);
+
+		// Update a box, returns true if it changed cells
+		bool		MoveProxy(int32_t proxy, const LibMath::Vector3& min, const LibMath::Vector3& max);
+
+		// User pointer given to CreateProxy
+		void*		GetUserData(int32_t proxy) const { return m_proxies[proxy].m_userData; }
+
+		// Rehash every proxy with a new cell size, or bucket count if not 0
+		void		SetCellSize(float cellSize, uint32_t bucketCount = 0);
+
+		float		GetCellSize(void) const { return m_cellSize; }
+
+		// Remove every proxy
+		void		Clear(void);
+
+		int32_t		GetProxyCount(void) const { return m_proxyCount; }
+
+		// Call func(proxy) once for every proxy whose box overlaps [min, max], return false from func to stop
+		template<typename TFunc>
+		void		Query(const LibMath::Vector3& min, const LibMath::Vector3& max, TFunc func) const;
+
+		// Call func(proxy) once for every proxy whose box a ray hits within maxDistance, return false from func to stop
+		// Walks the cells along the ray, inverseDir is 1 / direction, 0 on axes the ray does not move along (see Ray)
+		template<typename TFunc>
+		void		RayCast(const LibMath::Vector3& origin, const LibMath::Vector3& inverseDir, float maxDistance, TFunc func) const;
+
+		// Boxes covering more cells are not hashed
+		uint32_t	m_maxProxyCells = 64;
+
+	private:
+
+		struct CellRange
+		{
+			bool operator==(const CellRange& other) const = default;
+
+			int32_t		m_min[3] = {};
+			int32_t		m_max[3] = {};
+		};
+
+		struct Proxy
+		{
+			LibMath::Vector3	m_min;
+			LibMath::Vector3	m_max;
+
+			void*				m_userData = nullptr;
+			CellRange			m_cells;
+
+			// Position in m_large, or nullProxy if hashed into cells
+			int32_t				m_largeIndex = nullProxy;
+
+			// Next free proxy while in the free list
+			int32_t				m_nextFree = nullProxy;
+			bool				m_free = false;
+		};
+
+		int32_t		CellCoordinate(float position) const;
+		CellRange	CellsOf(const LibMath::Vector3& min, const LibMath::Vector3& max) const;
+		uint32_t	BucketOf(int32_t x, int32_t y, int32_t z) const;
+
+		// Put a proxy into or out of its cells' buckets (or the large list)
+		void		Link(int32_t proxy);
+		void		Unlink(int32_t proxy);
+
+		// Start a new stamp, visited marks of older queries no longer count
+		void		BeginQuery(void) const;
+
+		// Mark a proxy as visited by the current query, returns false if it already was
+		bool		Visit(int32_t proxy) const;
+
+		static bool	Overlap(const Proxy& proxy, const LibMath::Vector3& min, const LibMath::Vector3& max);
+
+		// Same slab test as Ray::Intersect, writes the entry distance
+		static bool	RayHit(const LibMath::Vector3& min, const LibMath::Vector3& max, const LibMath::Vector3& origin,
+						   const LibMath::Vector3& inverseDir, float& entry, float& exit);
+
+		float								m_cellSize = 4.f;
+		float								m_inverseCellSize = 0.25f;
+
+		std::vector<std::vector<int32_t>>	m_buckets = std::vector<std::vector<int32_t>>(4096);
+		std::vector<int32_t>				m_large;
+
+		std::vector<Proxy>					m_proxies;
+		int32_t								m_freeList = nullProxy;
+		int32_t								m_proxyCount = 0;
+
+		// Box around every hashed proxy, rays stop walking once they leave it
+		LibMath::Vector3					m_boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+		LibMath::Vector3					m_boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		// A proxy spans several cells, stamps report it once per query
+		mutable std::vector<uint32_t>		m_visited;
+		mutable uint32_t					m_queryStamp = 0;
+	};
+
+	template<typename TFunc>
+	void SpatialHashGrid::Query(const LibMath::Vector3& min, const LibMath::Vector3& max, TFunc func) const
+	{
+		if (m_proxyCount == 0)
+			return;
+
+		BeginQuery();
+
+		for (int32_t proxy : m_large)
+		{
+			if (Overlap(m_proxies[proxy], min, max) && !func(proxy))
+				return;
+		}
+
+		const CellRange cells = CellsOf(min, max);
+
+		for (int32_t x = cells.m_min[0]; x <= cells.m_max[0]; ++x)
+		{
+			for (int32_t y = cells.m_min[1]; y <= cells.m_max[1]; ++y)
+			{
+				for (int32_t z = cells.m_min[2]; z <= cells.m_max[2]; ++z)
+				{
+					// Buckets are shared by cells with the same hash, boxes are tested to filter them out
+					for (int32_t proxy : m_buckets[BucketOf(x, y, z)])
+					{
+						if (Overlap(m_proxies[proxy], min, max) && Visit(proxy) && !func(proxy))
+							return;
+					}
+				}
+			}
+		}
+	}
+
+	template<typename TFunc>
+	void SpatialHashGrid::RayCast(const LibMath::Vector3& origin, const LibMath::Vector3& inverseDir, float maxDistance, TFunc func) const
+	{
+		if (m_proxyCount == 0)
+			return;
+
+		BeginQuery();
+
+		float entry, exit;
+
+		for (int32_t proxy : m_large)
+		{
+			if (RayHit(m_proxies[proxy].m_min, m_proxies[proxy].m_max, origin, inverseDir, entry, exit) &&
+				entry <= maxDistance && !func(proxy))
+				return;
+		}
+
+		// Only walk the part of the ray inside the hashed boxes
+		if (!RayHit(m_boundsMin, m_boundsMax, origin, inverseDir, entry, exit))
+			return;
+
+		const float		start = LibMath::max(entry, 0.f);
+		const float		end = LibMath::min(exit, maxDistance);
+
+		int32_t			cell[3], step[3];
+		float			nextCrossing[3], crossingStep[3];
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float position = origin[axis] + (inverseDir[axis] != 0.f ? start / inverseDir[axis] : 0.f);
+
+			cell[axis] = CellCoordinate(position);
+
+			// Distance to the next cell boundary & between two boundaries
+			if (inverseDir[axis] > 0.f)
+			{
+				step[axis] = 1;
+				nextCrossing[axis] = start + (static_cast<float>(cell[axis] + 1) * m_cellSize - position) * inverseDir[axis];
+				crossingStep[axis] = m_cellSize * inverseDir[axis];
+			}
+			else if (inverseDir[axis] < 0.f)
+			{
+				step[axis] = -1;
+				nextCrossing[axis] = start + (static_cast<float>(cell[axis]) * m_cellSize - position) * inverseDir[axis];
+				crossingStep[axis] = -m_cellSize * inverseDir[axis];
+			}
+			else
+			{
+				step[axis] = 0;
+				nextCrossing[axis] = FLT_MAX;
+				crossingStep[axis] = FLT_MAX;
+			}
+		}
+
+		// Cell by cell (3D DDA), the distance walked only grows
+		for (float distance = start; distance <= end;)
+		{
+			for (int32_t proxy : m_buckets[BucketOf(cell[0], cell[1], cell[2])])
+			{
+				const Proxy& box = m_proxies[proxy];
+
+				if (RayHit(box.m_min, box.m_max, origin, inverseDir, entry, exit) && entry <= maxDistance &&
+					Visit(proxy) && !func(proxy))
+					return;
+			}
+
+			const int axis = nextCrossing[0] < nextCrossing[1] ?
+							 (nextCrossing[0] < nextCrossing[2] ? 0 : 2) : (nextCrossing[1] < nextCrossing[2] ? 1 : 2);
+
+			distance = nextCrossing[axis];
+			cell[axis] += step[axis];
+			nextCrossing[axis] += crossingStep[axis];
+		}
+	}
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "LibMath/Arithmetic.h"
+#include "LibMath/Vector/Vector3.h"
+
+namespace PhysicsLib
+{
+	// Sweep and prune over axis aligned boxes: box endpoints are kept sorted along x, y & z
+	// Moving a box insertion sorts its endpoints from where they were, boxes barely move between frames so few swaps happen
+	// Every swap between two boxes updates a persistent set of overlapping pairs, untouched pairs cost nothing
+	// Same proxy interface as DynamicAABBTree, queries scan the x axis: volumes from the widest box's reach, rays all of it
+	class SweepAndPrune
+	{
+	public:
+
+		// Index of no proxy
+		static constexpr int32_t	nullProxy = -1;
+
+		struct ProxyPair
+		{
+			int32_t		m_proxyA = nullProxy;
+			int32_t		m_proxyB = nullProxy;
+		};
+
+		// Constructor & destructor
+		SweepAndPrune(void) = default;
+		~SweepAndPrune(void) = default;
+
+		// Add a box, returns a proxy id that stays valid until DestroyProxy
+		int32_t		CreateProxy(const LibMath::Vector3& min, const LibMath::Vector3& max, void* userData);
+
+		// Remove a box & its pairs
+		void		DestroyProxy(int32_t proxy);
+
+		// Update a box & the pairs it starts or stops overlapping, returns true if any endpoint changed place
+		bool		MoveProxy(int32_t proxy, const LibMath::Vector3& min, const LibMath::Vector3& max);
+
+		// User pointer given to CreateProxy
+		void*		GetUserData(int32_t proxy) const { return m_proxies[proxy].m_userData; }
+
+		// Sort every axis from scratch & recompute the pairs, faster than many moves after a lot of boxes changed
+		// Pair changes are cleared, the new pair set is the starting point
+		void		Build(void);
+
+		// Remove every proxy & pair
+		void		Clear(void);
+
+		int32_t		GetProxyCount(void) const { return m_proxyCount; }
+
+		size_t		GetPairCount(void) const { return m_pairs.size(); }
+
+		// Call func(proxyA, proxyB) for every overlapping pair
+		template<typename TFunc>
+		void		ForEachPair(TFunc func) const;
+
+		// Pairs that started & stopped overlapping since the last ClearPairChanges, only if m_recordPairChanges is set
+		// A pair that started & stopped between two calls is in both lists
+		const std::vector<ProxyPair>&	GetAddedPairs(void) const { return m_addedPairs; }
+		const std::vector<ProxyPair>&	GetRemovedPairs(void) const { return m_removedPairs; }
+
+		void		ClearPairChanges(void);
+
+		// Call func(proxy) for every proxy whose box overlaps [min, max], return false from func to stop
+		template<typename TFunc>
+		void		Query(const LibMath::Vector3& min, const LibMath::Vector3& max, TFunc func) const;
+
+		// Call func(proxy) for every proxy whose box a ray hits within maxDistance, return false from func to stop
+		// inverseDir is 1 / direction, 0 on axes the ray does not move along (see Ray)
+		template<typename TFunc>
+		void		RayCast(const LibMath::Vector3& origin, const LibMath::Vector3& inverseDir, float maxDistance, TFunc func) const;
+
+		// Keep the added & removed pair lists, off by default so nobody has to clear them
+		bool		m_recordPairChanges = false;
+
+	private:
+
+		struct Endpoint
+		{
+			float		m_value;
+
+			// Proxy id shifted left once, lowest bit set for max endpoints
+			uint32_t	m_data;
+
+			int32_t		Proxy(void) const { return static_cast<int32_t>(m_data >> 1); }
+			bool		IsMax(void) const { return m_data & 1u; }
+		};
+
+		struct Proxy
+		{
+			LibMath::Vector3	m_min;
+			LibMath::Vector3	m_max;
+
+			void*				m_userData = nullptr;
+
+			// Position of the min & max endpoints on each axis
+			uint32_t			m_minIndex[3] = {};
+			uint32_t			m_maxIndex[3] = {};
+
+			// Next free proxy while in the free list
+			int32_t				m_nextFree = nullProxy;
+			bool				m_free = false;
+		};
+
+		// Endpoint order, min endpoints come first on equal values so touching boxes overlap
+		static bool	Less(const Endpoint& a, const Endpoint& b);
+
+		// Move an endpoint down or up its axis until sorted, updating pairs on the way
+		bool		SortDown(int axis, uint32_t index);
+		bool		SortUp(int axis, uint32_t index);
+
+		// Swap endpoints index & index + 1, then fix their proxies' indices & the pair set
+		void		Swap(int axis, uint32_t index);
+
+		void		SetIndex(int axis, uint32_t index);
+
+		bool		Overlap(int32_t proxyA, int32_t proxyB) const;
+
+		void		AddPair(int32_t proxyA, int32_t proxyB);
+		void		RemovePair(int32_t proxyA, int32_t proxyB);
+
+		static uint64_t	PairKey(int32_t proxyA, int32_t proxyB);
+
+		// Same slab test as Ray::Intersect
+		static bool	RayHit(const LibMath::Vector3& min, const LibMath::Vector3& max, const LibMath::Vector3& origin,
+						   const LibMath::Vector3& inverseDir, float maxDistance);
+
+		std::vector<Endpoint>			m_axes[3];
+		std::vector<Proxy>				m_proxies;
+		int32_t							m_freeList = nullProxy;
+		int32_t							m_proxyCount = 0;
+
+		// Widest box on x so far, only shrinks on Build
+		float							m_maxWidth = 0.f;
+
+		std::unordered_set<uint64_t>	m_pairs;
+		std::vector<ProxyPair>			m_addedPairs;
+		std::vector<ProxyPair>			m_removedPairs;
+	};
+
+	template<typename TFunc>
+	void SweepAndPrune::ForEachPair(TFunc func) const
+	{
+		for (uint64_t key : m_pairs)
+			func(static_cast<int32_t>(key >> 32), static_cast<int32_t>(key & 0xffffffffu));
+	}
+
+	template<typename TFunc>
+	void SweepAndPrune::Query(const LibMath::Vector3& min, const LibMath::Vector3& max, TFunc func) const
+	{
+		const std::vector<Endpoint>& endpoints = m_axes[0];
+
+		// Boxes starting further left than the widest box or after the query on x cannot overlap it
+		auto first = std::lower_bound(endpoints.begin(), endpoints.end(), min.m_x - m_maxWidth,
+									  [](const Endpoint& endpoint, float value) { return endpoint.m_value < value; });
+
+		for (auto current = first; current != endpoints.end(); ++current)
+		{
+			const Endpoint& endpoint = *current;
+
+			if (endpoint.m_value > max.m_x)
+				return;
+
+			if (endpoint.IsMax())
+				continue;
+
+			const Proxy& proxy = m_proxies[endpoint.Proxy()];
+
+			if (min.m_x <= proxy.m_max.m_x &&
+				proxy.m_min.m_y <= max.m_y && min.m_y <= proxy.m_max.m_y &&
+				proxy.m_min.m_z <= max.m_z && min.m_z <= proxy.m_max.m_z &&
+				!func(endpoint.Proxy()))
+				return;
+		}
+	}
+
+	template<typename TFunc>
+	void SweepAndPrune::RayCast(const LibMath::Vector3& origin, const LibMath::Vector3& inverseDir, float maxDistance, TFunc func) const
+	{
+		for (const Endpoint& endpoint : m_axes[0])
+		{
+			if (endpoint.IsMax())
+				continue;
+
+			const Proxy& proxy = m_proxies[endpoint.Proxy()];
+
+			if (RayHit(proxy.m_min, proxy.m_max, origin, inverseDir, maxDistance) && !func(endpoint.Proxy()))
+				return;
+		}
+	}
+}
@@ -1,4 +1,61 @@
+#include <algorithm>
+#include <cfloat>
+
 #include "PhysicsLib/ColliderHierarchy.hpp"
+#include "PhysicsLib/RayCast.h"
+
+#include "LibMath/Arithmetic.h"
+#include "LibMath/Batch.h"
+
+namespace
+{
+	// Box enclosing any collider type
+	void ColliderBounds(const Collider* collider, LibMath::Vector3& min, LibMath::Vector3& max)
+	{
+		if (collider->m_type == PhysicsLib::SPHERE)
+		{
+			const SphereBV*			sphere = static_cast<const SphereBV*>(collider);
+			const LibMath::Vector3	radius = { sphere->m_radius, sphere->m_radius, sphere->m_radius };
+
+			min = sphere->m_position - radius;
+			max = sphere->m_position + radius;
+		}
+		else
+		{
+			const BoxBV*			box = static_cast<const BoxBV*>(collider);
+
+			min = box->m_minVertex;
+			max = box->m_maxVertex;
+		}
+	}
+
+	// Spread the low 10 bits of value 3 bits apart
+	uint32_t SpreadBits(uint32_t value)
+	{
+		value &= 0x3ffu;
+		value = (value | (value << 16)) & 0x030000ffu;
+		value = (value | (value << 8)) & 0x0300f00fu;
+		value = (value | (value << 4)) & 0x030c30c3u;
+		value = (value | (value << 2)) & 0x09249249u;
+
+		return value;
+	}
+
+	// Z order curve index of a point within [min, max], nearby points get nearby codes
+	uint32_t MortonCode(const LibMath::Vector3& point, const LibMath::Vector3& min, const LibMath::Vector3& max)
+	{
+		auto cell = [](float value, float low, float high)
+		{
+			const float range = high - low;
+
+			return range > 0.f ? static_cast<uint32_t>((value - low) / range * 1023.f) : 0u;
+		};
+
+		return (SpreadBits(cell(point.m_x, min.m_x, max.m_x)) << 2) |
+			   (SpreadBits(cell(point.m_y, min.m_y, max.m_y)) << 1) |
+			    SpreadBits(cell(point.m_z, min.m_z, max.m_z));
+	}
+}
 
 
 BVHierarchy::BVNode::BVNode(BVNode* parent, Collider* collider)
@@ -22,12 +79,7 @@ void BVHierarchy::BVNode::Update(const Frustum & frustum)
 	default: break;
 	}
 
-	// Update children
-	for (BVNode* child : m_children)
-	{
-		child->Update(frustum);
-	}
-
+	UpdateProxy();
 }
 
 void BVHierarchy::BVNode::Update()
@@ -47,37 +99,34 @@ void BVHierarchy::BVNode::Update()
 	default: break;
 	}
 
-	// Update children
-	for (BVNode* child : m_children)
-	{
-		child->Update();
-	}
+	UpdateProxy();
+}
+
+void BVHierarchy::BVNode::UpdateProxy()
+{
+	if (m_owner)
+		m_owner->MoveProxy(this);
+}
+
+void BVHierarchy::BVNode::RemoveProxy()
+{
+	if (m_owner)
+		m_owner->DestroyProxy(this);
 }
 
 
 void BVHierarchy::BVNode::UpdateBox()
 {
 	// Get AABB
-	BoxBV*		box = dynamic_cast<BoxBV*>(m_collider);
+	BoxBV*		box = static_cast<BoxBV*>(m_collider);
+	Node*		sceneNode = m_sceneNode.Get();
 
 	// Update collider position and min/max vertices if it has a scene node
-	if (m_sceneNode)
+	if (sceneNode)
 	{
-		// Get translation and scale from scene node matrix
-
-		box->m_position =
-		{
-			m_sceneNode->m_globalTransform.m_matrix[3][0],
-			m_sceneNode->m_globalTransform.m_matrix[3][1],
-			m_sceneNode->m_globalTransform.m_matrix[3][2]
-		};
-
-		box->m_boxScale =
-		{
-			m_sceneNode->m_globalTransform.m_matrix[0][0],
-			m_sceneNode->m_globalTransform.m_matrix[1][1],
-			m_sceneNode->m_globalTransform.m_matrix[2][2]
-		};
+		// Transform the unit box of the mesh, also encloses rotated meshes
+		LibMath::transformAABB(sceneNode->GetGlobalTransform(), LibMath::Vector3::zero(), LibMath::Vector3::one(),
+							   box->m_position, box->m_boxScale);
 	}
 
 	// Update min and max vertices
@@ -88,32 +137,21 @@ void BVHierarchy::BVNode::UpdateBox()
 void BVHierarchy::BVNode::UpdateBox(const Frustum& frustum)
 {
 	// Get AABB
-	BoxBV*		box = dynamic_cast<BoxBV*>(m_collider);
+	BoxBV*		box = static_cast<BoxBV*>(m_collider);
+	Node*		sceneNode = m_sceneNode.Get();
 
 	// Update collider position and min/max vertices if it has a scene node
-	if (m_sceneNode)
+	if (sceneNode)
 	{
 		// Only render mesh if inside view frustum
 		if (!frustum.Intersect(*box))
-			m_sceneNode->m_render = false;
+			sceneNode->m_render = false;
 		else
-			m_sceneNode->m_render = true;
+			sceneNode->m_render = true;
 
-		// Get translation and scale from scene node matrix
-
-		box->m_position =
-		{
-			m_sceneNode->m_globalTransform.m_matrix[3][0],
-			m_sceneNode->m_globalTransform.m_matrix[3][1],
-			m_sceneNode->m_globalTransform.m_matrix[3][2]
-		};
-
-		box->m_boxScale =
-		{
-			m_sceneNode->m_globalTransform.m_matrix[0][0],
-			m_sceneNode->m_globalTransform.m_matrix[1][1],
-			m_sceneNode->m_globalTransform.m_matrix[2][2]
-		};
+		// Transform the unit box of the mesh, also encloses rotated meshes
+		LibMath::transformAABB(sceneNode->GetGlobalTransform(), LibMath::Vector3::zero(), LibMath::Vector3::one(),
+							   box->m_position, box->m_boxScale);
 	}
 
 	// Update min and max vertices
@@ -124,18 +162,20 @@ void BVHierarchy::BVNode::UpdateBox(const Frustum& frustum)
 
 void BVHierarchy::BVNode::UpdateSphere()
 {
-	if (!m_sceneNode)
+	Node* sceneNode = m_sceneNode.Get();
+
+	if (!sceneNode)
 		return;
 
 	// Get sphere
-	SphereBV*	sphere = dynamic_cast<SphereBV*>(m_collider);
+	SphereBV*	sphere = static_cast<SphereBV*>(m_collider);
 
 	// Update sphere from scene node matrix
 	sphere->m_position =
 	{
-		m_sceneNode->m_globalTransform.m_matrix[3][0],
-		m_sceneNode->m_globalTransform.m_matrix[3][1],
-		m_sceneNode->m_globalTransform.m_matrix[3][2]
+		sceneNode->GetGlobalTransform().m_matrix[3][0],
+		sceneNode->GetGlobalTransform().m_matrix[3][1],
+		sceneNode->GetGlobalTransform().m_matrix[3][2]
 	};
 }
 
@@ -156,13 +196,13 @@ bool BVHierarchy::BVNode::TestCollision(Collider* target)
 	case PhysicsLib::HOLED:
 	case PhysicsLib::TELEPORTER:
 	case PhysicsLib::FINAL_TOWER:
-		boxTarget = dynamic_cast<BoxBV*>(target);
+		boxTarget = static_cast<BoxBV*>(target);
 
 		return CheckNodeType(boxTarget);
 
 	// Sphere
 	case PhysicsLib::SPHERE:
-		sphereTarget = dynamic_cast<SphereBV*>(target);
+		sphereTarget = static_cast<SphereBV*>(target);
 
 		return CheckNodeType(sphereTarget);
 
@@ -174,30 +214,215 @@ bool BVHierarchy::BVNode::TestCollision(Collider* target)
 
 }
 
-void BVHierarchy::BVNode::PruneColliders(Collider* target, std::vector<BVHierarchy::BVNode*>& prunedList, BVHierarchy::BVNode* collider)
+void BVHierarchy::DeleteCollider(Key key)
 {
-	// Prune collider's children if no intersection occured
-	if (!collider->TestCollision(target))
-	{
+	BVNode* node = m_hierarchy.GetNode(key);
+
+	if (!node)
 		return;
+
+	BVNode* parent = node->m_parent;
+
+	m_hierarchy.DeleteNode(node);
+	m_bakeDirty = true;
+
+	if (parent && parent->m_children.empty())
+		AddProxy(parent);
+}
+
+void BVHierarchy::Update()
+{
+	if (m_bakeDirty)
+		Bake();
+
+	for (BVNode* node : m_dynamicNodes)
+		node->Update();
+}
+
+void BVHierarchy::Update(const Frustum& frustum)
+{
+	if (m_bakeDirty)
+		Bake();
+
+	for (BVNode* node : m_dynamicNodes)
+		node->Update(frustum);
+
+	// Static meshes are only culled, their boxes do not change
+	m_staticCuller.Cull(frustum);
+
+	for (size_t index = 0; index < m_staticSceneNodes.size(); ++index)
+	{
+		if (Node* sceneNode = m_staticSceneNodes[index].Get())
+			sceneNode->m_render = m_staticCuller.IsVisible(index);
 	}
+}
+
+void BVHierarchy::Bake(void)
+{
+	m_dynamicNodes.clear();
+	m_staticCuller.Clear();
+	m_staticSceneNodes.clear();
 
-	// Add its cildren otherwise
-	if (collider->m_children.size())
+	std::vector<BVNode*>	culled;
+	LibMath::Vector3		min(FLT_MAX, FLT_MAX, FLT_MAX), max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	for (BVNode* node : m_hierarchy.PreOrder())
 	{
-		for (BVHierarchy::BVNode* child : collider->m_children)
+		// Last refit of static colliders until the next bake
+		node->Update();
+
+		if (!node->m_static)
 		{
-			if (child->m_children.size())
-				PruneColliders(target, prunedList, child);
-			else
-				prunedList.push_back(child);
+			m_dynamicNodes.push_back(node);
+			continue;
+		}
+
+		// Only boxes linked to a mesh have anything to cull
+		const PhysicsLib::COLLIDER_TYPE type = node->m_collider->m_type;
+
+		if ((type == PhysicsLib::BOX || type == PhysicsLib::COLOR_CUBE) && node->m_sceneNode.Get())
+		{
+			const BoxBV* box = static_cast<const BoxBV*>(node->m_collider);
+
+			min.m_x = LibMath::min(min.m_x, box->m_position.m_x);
+			min.m_y = LibMath::min(min.m_y, box->m_position.m_y);
+			min.m_z = LibMath::min(min.m_z, box->m_position.m_z);
+
+			max.m_x = LibMath::max(max.m_x, box->m_position.m_x);
+			max.m_y = LibMath::max(max.m_y, box->m_position.m_y);
+			max.m_z = LibMath::max(max.m_z, box->m_position.m_z);
+
+			culled.push_back(node);
 		}
 	}
 
+	// Culled in space order, neighbours in a lane group are often rejected by the same plane (see FrustumCuller)
+	std::vector<std::pair<uint32_t, BVNode*>> order;
+
+	order.reserve(culled.size());
+
+	for (BVNode* node : culled)
+		order.emplace_back(MortonCode(static_cast<const BoxBV*>(node->m_collider)->m_position, min, max), node);
+
+	std::sort(order.begin(), order.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+	for (const auto& [code, node] : order)
+	{
+		const BoxBV* box = static_cast<const BoxBV*>(node->m_collider);
+
+		m_staticCuller.Add(box->m_position, box->m_boxScale);
+		m_staticSceneNodes.push_back(node->m_sceneNode);
+	}
+
+	m_bakeDirty = false;
+}
+
+void BVHierarchy::AddProxy(BVNode* node)
+{
+	// Only childless nodes are tested as colliders
+	if (node->m_parent)
+		node->m_parent->RemoveProxy();
+
+	CreateProxy(node);
+}
+
+void BVHierarchy::CreateProxy(BVNode* node)
+{
+	LibMath::Vector3	min, max;
+
+	ColliderBounds(node->m_collider, min, max);
+
+	node->m_owner = this;
+	node->m_proxy = WithBroadphase([&](auto& broadphase) { return broadphase.CreateProxy(min, max, node); });
+}
+
+void BVHierarchy::MoveProxy(BVNode* node)
+{
+	LibMath::Vector3	min, max;
+
+	ColliderBounds(node->m_collider, min, max);
+
+	// Static colliders keep their cells, endpoints or fat box & return right away
+	WithBroadphase([&](auto& broadphase) { broadphase.MoveProxy(node->m_proxy, min, max); });
+}
+
+void BVHierarchy::DestroyProxy(BVNode* node)
+{
+	WithBroadphase([&](auto& broadphase) { broadphase.DestroyProxy(node->m_proxy); });
+
+	node->m_owner = nullptr;
+	node->m_proxy = -1;
+}
+
+void BVHierarchy::BuildBroadphase(void)
+{
+	// Boxes may have moved or been set by hand since they were added, refit them all (also bakes static colliders)
+	Bake();
+
+	if (m_broadphase == BroadphaseType::TREE)
+		m_tree.Build();
+	else if (m_broadphase == BroadphaseType::SWEEP_AND_PRUNE)
+		m_sweep.Build();
+}
+
+void BVHierarchy::SetBroadphase(BroadphaseType broadphase)
+{
+	if (broadphase == m_broadphase)
+		return;
+
+	const std::vector<BVNode*>& order = m_hierarchy.PreOrder();
+
+	for (BVNode* node : order)
+		node->RemoveProxy();
+
+	m_broadphase = broadphase;
+
+	for (BVNode* node : order)
+	{
+		if (node->m_children.empty())
+			CreateProxy(node);
+	}
+
+	BuildBroadphase();
+}
+
+void BVHierarchy::QueryColliders(Collider* target, std::vector<BVNode*>& result)
+{
+	result.clear();
+
+	LibMath::Vector3	min, max;
+
+	ColliderBounds(target, min, max);
+
+	WithBroadphase([&](auto& broadphase)
+	{
+		broadphase.Query(min, max, [&](int32_t proxy)
+		{
+			result.push_back(static_cast<BVNode*>(broadphase.GetUserData(proxy)));
+			return true;
+		});
+	});
+}
+
+void BVHierarchy::QueryColliders(const Ray& ray, std::vector<BVNode*>& result)
+{
+	result.clear();
+
+	WithBroadphase([&](auto& broadphase)
+	{
+		broadphase.RayCast(ray.m_origin, ray.m_inverseDir, FLT_MAX, [&](int32_t proxy)
+		{
+			result.push_back(static_cast<BVNode*>(broadphase.GetUserData(proxy)));
+			return true;
+		});
+	});
 }
 
 BVHierarchy::BVNode::~BVNode(void)
 {
+	// Leave the tree before the collider goes
+	RemoveProxy();
+
 	// Delete collider
 	if (m_collider)
 	{
@@ -207,15 +432,7 @@ BVHierarchy::BVNode::~BVNode(void)
 
 	// Delete children nodes
 	for (BVNode* child : m_children)
-	{
-		if (child)
-		{
-			child->~BVNode();
-			delete child;
-		}
-	}
-
-	m_children.~vector();
+		delete child;
 }
 
 bool BVHierarchy::BVNode::CheckNodeType(BoxBV* target)
@@ -234,13 +451,13 @@ bool BVHierarchy::BVNode::CheckNodeType(BoxBV* target)
 	case PhysicsLib::HOLED:
 	case PhysicsLib::TELEPORTER:
 	case PhysicsLib::FINAL_TOWER:
-		boxCollider = dynamic_cast<BoxBV*>(m_collider);
+		boxCollider = static_cast<BoxBV*>(m_collider);
 
 		return CheckCollisions(target, boxCollider);
 
 	// Sphere
 	case PhysicsLib::SPHERE:
-		sphereCollider = dynamic_cast<SphereBV*>(m_collider);
+		sphereCollider = static_cast<SphereBV*>(m_collider);
 
 		return CheckCollisions(target, sphereCollider);
 
@@ -267,13 +484,13 @@ bool BVHierarchy::BVNode::CheckNodeType(SphereBV* target)
 	case PhysicsLib::HOLED:
 	case PhysicsLib::TELEPORTER:
 	case PhysicsLib::FINAL_TOWER:
-		boxCollider = dynamic_cast<BoxBV*>(m_collider);
+		boxCollider = static_cast<BoxBV*>(m_collider);
 
 		return CheckCollisions(target, boxCollider);
 
 	// Sphere
 	case PhysicsLib::SPHERE:
-		sphereCollider = dynamic_cast<SphereBV*>(m_collider);
+		sphereCollider = static_cast<SphereBV*>(m_collider);
 
 		return CheckCollisions(target, sphereCollider);
 
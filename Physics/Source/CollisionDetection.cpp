@@ -108,14 +108,11 @@ bool PhysicsLib::BoxCollider::CheckCollision(SphereCollider const& sphereCollide
 	axis.m_y = LibMath::max(m_minVertex.m_y, LibMath::min(sphereCollider.m_position.m_y, m_maxVertex.m_y));
 	axis.m_z = LibMath::max(m_minVertex.m_z, LibMath::min(sphereCollider.m_position.m_z, m_maxVertex.m_z));
 
-	// Get distance
-	distance = LibMath::squareRoot(
-		(axis.m_x - sphereCollider.m_position.m_x) * (axis.m_x - sphereCollider.m_position.m_x) +
-		(axis.m_y - sphereCollider.m_position.m_y) * (axis.m_y - sphereCollider.m_position.m_y) +
-		(axis.m_z - sphereCollider.m_position.m_z) * (axis.m_z - sphereCollider.m_position.m_z));
+	// Get squared distance, compared with the squared radius so no square root is needed
+	distance = axis.distanceSquaredFrom(sphereCollider.m_position);
 
 	// Check if distance if further than the radius which indicates if the box is inside the sphere
-	return distance < sphereCollider.m_radius;
+	return distance < sphereCollider.m_radius * sphereCollider.m_radius;
 }
 
 PhysicsLib::SphereCollider::SphereCollider(float const& radius, LibMath::Vector3 const& position)
@@ -140,30 +137,24 @@ bool PhysicsLib::SphereCollider::CheckCollision(SphereCollider const& sphere1, S
 {
 	// Collision detection between two spheres
 
-	// Calculate distance between the two spheres
-	float	distance = LibMath::squareRoot(
-		(sphere1.m_position.m_x - sphere2.m_position.m_x) * (sphere1.m_position.m_x - sphere2.m_position.m_x) +
-		(sphere1.m_position.m_y - sphere2.m_position.m_y) * (sphere1.m_position.m_y - sphere2.m_position.m_y) +
-		(sphere1.m_position.m_z - sphere2.m_position.m_z) * (sphere1.m_position.m_z - sphere2.m_position.m_z)
-	);
+	// Calculate squared distance between the two spheres
+	float	distance = sphere1.m_position.distanceSquaredFrom(sphere2.m_position);
+	float	radiuses = sphere1.m_radius + sphere2.m_radius;
 
-	// Check if the distance is smaller than both radiuses & return result
-	return distance < sphere1.m_radius + sphere2.m_radius;
+	// Check if the distance is smaller than both radiuses & return result, squared so no square root is needed
+	return distance < radiuses * radiuses;
 }
 
 bool PhysicsLib::SphereCollider::CheckCollision(SphereCollider const& sphere2)
 {
 	// Collision detection between two spheres
 
-	// Calculate distance between the two spheres
-	float	distance = LibMath::squareRoot(
-		(m_position.m_x - sphere2.m_position.m_x) * (m_position.m_x - sphere2.m_position.m_x) +
-		(m_position.m_y - sphere2.m_position.m_y) * (m_position.m_y - sphere2.m_position.m_y) +
-		(m_position.m_z - sphere2.m_position.m_z) * (m_position.m_z - sphere2.m_position.m_z)
-	);
+	// Calculate squared distance between the two spheres
+	float	distance = m_position.distanceSquaredFrom(sphere2.m_position);
+	float	radiuses = m_radius + sphere2.m_radius;
 
-	// Check if the distance is smaller than both radiuses & return result
-	return distance < m_radius + sphere2.m_radius;
+	// Check if the distance is smaller than both radiuses & return result, squared so no square root is needed
+	return distance < radiuses * radiuses;
 }
 
 bool PhysicsLib::SphereCollider::CheckCollision(BoxCollider const& boxCollider)
@@ -178,14 +169,11 @@ bool PhysicsLib::SphereCollider::CheckCollision(BoxCollider const& boxCollider)
 	axis.m_y = LibMath::max(boxCollider.m_minVertex.m_y, LibMath::min(m_position.m_y, boxCollider.m_maxVertex.m_y));
 	axis.m_z = LibMath::max(boxCollider.m_minVertex.m_z, LibMath::min(m_position.m_z, boxCollider.m_maxVertex.m_z));
 
-	// Get distance
-	distance = LibMath::squareRoot(
-		(axis.m_x - m_position.m_x) * (axis.m_x - m_position.m_x) +
-		(axis.m_y - m_position.m_y) * (axis.m_y - m_position.m_y) +
-		(axis.m_z - m_position.m_z) * (axis.m_z - m_position.m_z));
+	// Get squared distance, compared with the squared radius so no square root is needed
+	distance = axis.distanceSquaredFrom(m_position);
 
 	// Check if distance if further than the radius which indicates if the box is inside the sphere
-	return distance <= m_radius;
+	return distance <= m_radius * m_radius;
 }
 
 bool PhysicsLib::SphereCollider::CheckCollision(SphereCollider const& sphereCollider, BoxCollider const& boxCollider)
@@ -204,14 +192,11 @@ bool PhysicsLib::SphereCollider::CheckCollision(SphereCollider const& sphereColl
 	axis.m_y = LibMath::max(boxCollider.m_minVertex.m_y, LibMath::min(sphereCollider.m_position.m_y, boxCollider.m_maxVertex.m_y));
 	axis.m_z = LibMath::max(boxCollider.m_minVertex.m_z, LibMath::min(sphereCollider.m_position.m_z, boxCollider.m_maxVertex.m_z));
 
-	// Get distance
-	distance = LibMath::squareRoot(
-		(axis.m_x - sphereCollider.m_position.m_x) * (axis.m_x - sphereCollider.m_position.m_x) +
-		(axis.m_y - sphereCollider.m_position.m_y) * (axis.m_y - sphereCollider.m_position.m_y) +
-		(axis.m_z - sphereCollider.m_position.m_z) * (axis.m_z - sphereCollider.m_position.m_z));
+	// Get squared distance, compared with the squared radius so no square root is needed
+	distance = axis.distanceSquaredFrom(sphereCollider.m_position);
 
 	// Check if distance if further than the radius which indicates if the box is inside the sphere
-	return distance <= sphereCollider.m_radius;
+	return distance <= sphereCollider.m_radius * sphereCollider.m_radius;
 }
 
 PhysicsLib::ColoredBoxCollider::ColoredBoxCollider(LibMath::Vector3 const& position, LibMath::Vector3 const& boxScale, COLLIDER_TYPE type)
@@ -0,0 +1,467 @@
+#include <algorithm>
+#include <cfloat>
+
+#include "PhysicsLib/DynamicAABBTree.h"
+
+namespace
+{
+	// Bins per SAH split, more bins give slightly better splits for a slower build
+	constexpr int	binCount = 12;
+
+	struct Bounds
+	{
+		// Grow to enclose a box
+		void Add(const LibMath::Vector3& min, const LibMath::Vector3& max)
+		{
+			m_min = { LibMath::min(m_min.m_x, min.m_x), LibMath::min(m_min.m_y, min.m_y), LibMath::min(m_min.m_z, min.m_z) };
+			m_max = { LibMath::max(m_max.m_x, max.m_x), LibMath::max(m_max.m_y, max.m_y), LibMath::max(m_max.m_z, max.m_z) };
+		}
+
+		// Half the surface area, enough to compare costs
+		float Area(void) const
+		{
+			if (m_min.m_x > m_max.m_x)
+				return 0.f;
+
+			const LibMath::Vector3 size = m_max - m_min;
+
+			return size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x;
+		}
+
+		LibMath::Vector3	m_min = { FLT_MAX, FLT_MAX, FLT_MAX };
+		LibMath::Vector3	m_max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	};
+
+	float UnionArea(const LibMath::Vector3& minA, const LibMath::Vector3& maxA,
+					const LibMath::Vector3& minB, const LibMath::Vector3& maxB)
+	{
+		Bounds bounds;
+
+		bounds.Add(minA, maxA);
+		bounds.Add(minB, maxB);
+
+		return bounds.Area();
+	}
+}
+
+int32_t PhysicsLib::DynamicAABBTree::CreateProxy(const LibMath::Vector3& min, const LibMath::Vector3& max, void* userData)
+{
+	const int32_t			proxy = AllocateNode();
+	const LibMath::Vector3	margin = { m_margin, m_margin, m_margin };
+
+	TreeNode& node = m_nodes[proxy];
+
+	node.m_min = min - margin;
+	node.m_max = max + margin;
+	node.m_userData = userData;
+	node.m_height = 0;
+
+	InsertLeaf(proxy);
+	++m_proxyCount;
+
+	return proxy;
+}
+
+void PhysicsLib::DynamicAABBTree::DestroyProxy(int32_t proxy)
+{
+	RemoveLeaf(proxy);
+	FreeNode(proxy);
+	--m_proxyCount;
+}
+
+bool PhysicsLib::DynamicAABBTree::MoveProxy(int32_t proxy, const LibMath::Vector3& min, const LibMath::Vector3& max)
+{
+	TreeNode& node = m_nodes[proxy];
+
+	// Still inside its fat box, the tree does not change
+	if (node.m_min.m_x <= min.m_x && node.m_min.m_y <= min.m_y && node.m_min.m_z <= min.m_z &&
+		max.m_x <= node.m_max.m_x && max.m_y <= node.m_max.m_y && max.m_z <= node.m_max.m_z)
+		return false;
+
+	RemoveLeaf(proxy);
+
+	const LibMath::Vector3	margin = { m_margin, m_margin, m_margin };
+
+	node.m_min = min - margin;
+	node.m_max = max + margin;
+
+	InsertLeaf(proxy);
+
+	return true;
+}
+
+void PhysicsLib::DynamicAABBTree::Build(void)
+{
+	std::vector<int32_t>	leaves;
+
+	leaves.reserve(m_proxyCount);
+
+	// Keep leaves where they are so proxy ids stay valid, free every internal node
+	for (int32_t index = 0; index < static_cast<int32_t>(m_nodes.size()); ++index)
+	{
+		if (m_nodes[index].m_height == 0)
+			leaves.push_back(index);
+		else if (m_nodes[index].m_height > 0)
+			FreeNode(index);
+	}
+
+	m_root = leaves.empty() ? nullNode : BuildRange(leaves, 0, static_cast<int32_t>(leaves.size()));
+
+	if (m_root != nullNode)
+		m_nodes[m_root].m_parent = nullNode;
+}
+
+void PhysicsLib::DynamicAABBTree::Clear(void)
+{
+	m_nodes.clear();
+
+	m_root = nullNode;
+	m_freeList = nullNode;
+	m_proxyCount = 0;
+}
+
+int32_t PhysicsLib::DynamicAABBTree::AllocateNode(void)
+{
+	if (m_freeList == nullNode)
+	{
+		m_nodes.emplace_back();
+		return static_cast<int32_t>(m_nodes.size()) - 1;
+	}
+
+	const int32_t	index = m_freeList;
+
+	m_freeList = m_nodes[index].m_parent;
+	m_nodes[index] = TreeNode();
+
+	return index;
+}
+
+void PhysicsLib::DynamicAABBTree::FreeNode(int32_t node)
+{
+	// Parent links the free list
+	m_nodes[node].m_parent = m_freeList;
+	m_nodes[node].m_child1 = nullNode;
+	m_nodes[node].m_child2 = nullNode;
+	m_nodes[node].m_userData = nullptr;
+	m_nodes[node].m_height = -1;
+
+	m_freeList = node;
+}
+
+void PhysicsLib::DynamicAABBTree::InsertLeaf(int32_t leaf)
+{
+	if (m_root == nullNode)
+	{
+		m_root = leaf;
+		m_nodes[leaf].m_parent = nullNode;
+		return;
+	}
+
+	const LibMath::Vector3	leafMin = m_nodes[leaf].m_min;
+	const LibMath::Vector3	leafMax = m_nodes[leaf].m_max;
+
+	// Walk down to the cheapest sibling, cost is the area added to the tree
+	int32_t					sibling = m_root;
+
+	while (!m_nodes[sibling].IsLeaf())
+	{
+		const TreeNode&		node = m_nodes[sibling];
+		const float			area = UnionArea(node.m_min, node.m_max, node.m_min, node.m_max);
+		const float			combinedArea = UnionArea(node.m_min, node.m_max, leafMin, leafMax);
+
+		// Pairing with this node creates a parent of combinedArea
+		const float			cost = 2.f * combinedArea;
+
+		// Going deeper grows this node anyway
+		const float			inheritanceCost = 2.f * (combinedArea - area);
+
+		float				childCosts[2];
+		const int32_t		children[2] = { node.m_child1, node.m_child2 };
+
+		for (int child = 0; child < 2; ++child)
+		{
+			const TreeNode& childNode = m_nodes[children[child]];
+
+			childCosts[child] = UnionArea(childNode.m_min, childNode.m_max, leafMin, leafMax) + inheritanceCost;
+
+			if (!childNode.IsLeaf())
+				childCosts[child] -= UnionArea(childNode.m_min, childNode.m_max, childNode.m_min, childNode.m_max);
+		}
+
+		if (cost < childCosts[0] && cost < childCosts[1])
+			break;
+
+		sibling = childCosts[0] < childCosts[1] ? children[0] : children[1];
+	}
+
+	// New parent in place of the sibling, may reallocate the node array
+	const int32_t	oldParent = m_nodes[sibling].m_parent;
+	const int32_t	newParent = AllocateNode();
+
+	m_nodes[newParent].m_parent = oldParent;
+	m_nodes[newParent].m_child1 = sibling;
+	m_nodes[newParent].m_child2 = leaf;
+
+	if (oldParent == nullNode)
+		m_root = newParent;
+	else if (m_nodes[oldParent].m_child1 == sibling)
+		m_nodes[oldParent].m_child1 = newParent;
+	else
+		m_nodes[oldParent].m_child2 = newParent;
+
+	m_nodes[sibling].m_parent = newParent;
+	m_nodes[leaf].m_parent = newParent;
+
+	Refit(newParent);
+}
+
+void PhysicsLib::DynamicAABBTree::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == m_root)
+	{
+		m_root = nullNode;
+		return;
+	}
+
+	// The sibling takes the parent's place
+	const int32_t	parent = m_nodes[leaf].m_parent;
+	const int32_t	grandParent = m_nodes[parent].m_parent;
+	const int32_t	sibling = m_nodes[parent].m_child1 == leaf ? m_nodes[parent].m_child2 : m_nodes[parent].m_child1;
+
+	m_nodes[sibling].m_parent = grandParent;
+	m_nodes[leaf].m_parent = nullNode;
+
+	FreeNode(parent);
+
+	if (grandParent == nullNode)
+	{
+		m_root = sibling;
+		return;
+	}
+
+	if (m_nodes[grandParent].m_child1 == parent)
+		m_nodes[grandParent].m_child1 = sibling;
+	else
+		m_nodes[grandParent].m_child2 = sibling;
+
+	Refit(grandParent);
+}
+
+int32_t PhysicsLib::DynamicAABBTree::Balance(int32_t indexA)
+{
+	TreeNode&	nodeA = m_nodes[indexA];
+
+	if (nodeA.IsLeaf() || nodeA.m_height < 2)
+		return indexA;
+
+	const int32_t	indexB = nodeA.m_child1;
+	const int32_t	indexC = nodeA.m_child2;
+
+	TreeNode&	nodeB = m_nodes[indexB];
+	TreeNode&	nodeC = m_nodes[indexC];
+
+	const int32_t	balance = nodeC.m_height - nodeB.m_height;
+
+	if (balance > -2 && balance < 2)
+		return indexA;
+
+	// Promote the taller child, A takes its shorter grandchild
+	const int32_t	indexUp = balance > 0 ? indexC : indexB;
+	const int32_t	indexKept = balance > 0 ? indexB : indexC;
+
+	TreeNode&	nodeUp = m_nodes[indexUp];
+	TreeNode&	nodeKept = m_nodes[indexKept];
+
+	const int32_t	indexF = nodeUp.m_child1;
+	const int32_t	indexG = nodeUp.m_child2;
+
+	// Up replaces A under A's parent
+	nodeUp.m_parent = nodeA.m_parent;
+	nodeA.m_parent = indexUp;
+
+	if (nodeUp.m_parent == nullNode)
+		m_root = indexUp;
+	else if (m_nodes[nodeUp.m_parent].m_child1 == indexA)
+		m_nodes[nodeUp.m_parent].m_child1 = indexUp;
+	else
+		m_nodes[nodeUp.m_parent].m_child2 = indexUp;
+
+	// The taller grandchild stays under Up, the other moves to A
+	const bool		keepF = m_nodes[indexF].m_height > m_nodes[indexG].m_height;
+	const int32_t	indexStay = keepF ? indexF : indexG;
+	const int32_t	indexMove = keepF ? indexG : indexF;
+
+	TreeNode&	nodeStay = m_nodes[indexStay];
+	TreeNode&	nodeMove = m_nodes[indexMove];
+
+	nodeUp.m_child1 = indexA;
+	nodeUp.m_child2 = indexStay;
+
+	if (balance > 0)
+		nodeA.m_child2 = indexMove;
+	else
+		nodeA.m_child1 = indexMove;
+
+	nodeMove.m_parent = indexA;
+
+	Bounds		boundsA;
+
+	boundsA.Add(nodeKept.m_min, nodeKept.m_max);
+	boundsA.Add(nodeMove.m_min, nodeMove.m_max);
+
+	nodeA.m_min = boundsA.m_min;
+	nodeA.m_max = boundsA.m_max;
+	nodeA.m_height = 1 + std::max(nodeKept.m_height, nodeMove.m_height);
+
+	Bounds		boundsUp;
+
+	boundsUp.Add(nodeA.m_min, nodeA.m_max);
+	boundsUp.Add(nodeStay.m_min, nodeStay.m_max);
+
+	nodeUp.m_min = boundsUp.m_min;
+	nodeUp.m_max = boundsUp.m_max;
+	nodeUp.m_height = 1 + std::max(nodeA.m_height, nodeStay.m_height);
+
+	return indexUp;
+}
+
+void PhysicsLib::DynamicAABBTree::Refit(int32_t node)
+{
+	for (int32_t index = node; index != nullNode; index = m_nodes[index].m_parent)
+	{
+		index = Balance(index);
+
+		TreeNode&		current = m_nodes[index];
+		const TreeNode&	child1 = m_nodes[current.m_child1];
+		const TreeNode&	child2 = m_nodes[current.m_child2];
+
+		Bounds			bounds;
+
+		bounds.Add(child1.m_min, child1.m_max);
+		bounds.Add(child2.m_min, child2.m_max);
+
+		current.m_min = bounds.m_min;
+		current.m_max = bounds.m_max;
+		current.m_height = 1 + std::max(child1.m_height, child2.m_height);
+	}
+}
+
+int32_t PhysicsLib::DynamicAABBTree::BuildRange(std::vector<int32_t>& leaves, int32_t first, int32_t last)
+{
+	if (last - first == 1)
+		return leaves[first];
+
+	// Split along the axis the box centers spread the most on
+	Bounds		centers;
+
+	for (int32_t index = first; index < last; ++index)
+	{
+		const TreeNode&			leaf = m_nodes[leaves[index]];
+		const LibMath::Vector3	center = (leaf.m_min + leaf.m_max) * 0.5f;
+
+		centers.Add(center, center);
+	}
+
+	const LibMath::Vector3	extent = centers.m_max - centers.m_min;
+	const int				axis = extent.m_x >= extent.m_y && extent.m_x >= extent.m_z ? 0 : (extent.m_y >= extent.m_z ? 1 : 2);
+	const float				axisMin = centers.m_min[axis];
+	const float				axisExtent = extent[axis];
+
+	int32_t		middle = first + (last - first) / 2;
+
+	auto		binOf = [&](int32_t leaf)
+	{
+		const float center = (m_nodes[leaf].m_min[axis] + m_nodes[leaf].m_max[axis]) * 0.5f;
+		const int	bin = static_cast<int>((center - axisMin) / axisExtent * binCount);
+
+		return std::min(bin, binCount - 1);
+	};
+
+	if (axisExtent > 0.f)
+	{
+		// Bin the leaves, then sweep both ways for the cheapest split between bins
+		Bounds		bins[binCount];
+		int32_t		counts[binCount] = {};
+
+		for (int32_t index = first; index < last; ++index)
+		{
+			const int		bin = binOf(leaves[index]);
+
+			bins[bin].Add(m_nodes[leaves[index]].m_min, m_nodes[leaves[index]].m_max);
+			++counts[bin];
+		}
+
+		float		leftCosts[binCount - 1];
+		Bounds		left;
+		int32_t		leftCount = 0;
+
+		for (int split = 0; split < binCount - 1; ++split)
+		{
+			left.Add(bins[split].m_min, bins[split].m_max);
+			leftCount += counts[split];
+			leftCosts[split] = left.Area() * static_cast<float>(leftCount);
+		}
+
+		Bounds		right;
+		int32_t		rightCount = 0;
+		float		bestCost = FLT_MAX;
+		int			bestSplit = -1;
+
+		for (int split = binCount - 2; split >= 0; --split)
+		{
+			right.Add(bins[split + 1].m_min, bins[split + 1].m_max);
+			rightCount += counts[split + 1];
+
+			const int32_t	leftSide = (last - first) - rightCount;
+			const float		cost = leftCosts[split] + right.Area() * static_cast<float>(rightCount);
+
+			if (leftSide > 0 && rightCount > 0 && cost < bestCost)
+			{
+				bestCost = cost;
+				bestSplit = split;
+			}
+		}
+
+		if (bestSplit >= 0)
+		{
+			auto	split = std::partition(leaves.begin() + first, leaves.begin() + last,
+										   [&](int32_t leaf) { return binOf(leaf) <= bestSplit; });
+
+			middle = static_cast<int32_t>(split - leaves.begin());
+		}
+	}
+
+	// Identical centers or all in one bin, split the count in half
+	if (middle == first || middle == last || axisExtent <= 0.f)
+		middle = first + (last - first) / 2;
+
+	const int32_t	child1 = BuildRange(leaves, first, middle);
+	const int32_t	child2 = BuildRange(leaves, middle, last);
+	const int32_t	parent = AllocateNode();
+
+	TreeNode&		node = m_nodes[parent];
+
+	node.m_child1 = child1;
+	node.m_child2 = child2;
+	node.m_height = 1 + std::max(m_nodes[child1].m_height, m_nodes[child2].m_height);
+
+	Bounds			bounds;
+
+	bounds.Add(m_nodes[child1].m_min, m_nodes[child1].m_max);
+	bounds.Add(m_nodes[child2].m_min, m_nodes[child2].m_max);
+
+	node.m_min = bounds.m_min;
+	node.m_max = bounds.m_max;
+
+	m_nodes[child1].m_parent = parent;
+	m_nodes[child2].m_parent = parent;
+
+	return parent;
+}
+
+bool PhysicsLib::DynamicAABBTree::Overlap(const TreeNode& node, const LibMath::Vector3& min, const LibMath::Vector3& max)
+{
+	return node.m_min.m_x <= max.m_x && min.m_x <= node.m_max.m_x &&
+		   node.m_min.m_y <= max.m_y && min.m_y <= node.m_max.m_y &&
+		   node.m_min.m_z <= max.m_z && min.m_z <= node.m_max.m_z;
+}
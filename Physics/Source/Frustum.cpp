@@ -15,53 +15,6 @@ Plane::Plane(const LibMath::Vector3& point, const LibMath::Vector3& normal)
 	m_direction = -point.magnitude();
 }
 
-Plane&	Frustum::operator[](PLANE index)
-{
-	// Access plane with PLANE enum as index
-	switch (index)
-	{
-	case NEAR:
-		return m_near;
-	case FAR:
-		return m_far;
-	case LEFT:
-		return m_left;
-	case RIGHT:
-		return m_right;
-	case TOP:
-		return m_top;
-
-	case BOTTOM:
-	default:
-		return m_bottom;
-	}
-}
-
-
-Plane Frustum::operator[](PLANE index) const
-{
-	// Access plane with PLANE enum as index
-	switch (index)
-	{
-	case NEAR:
-		return m_near;
-	case FAR:
-		return m_far;
-	case LEFT:
-		return m_left;
-	case RIGHT:
-		return m_right;
-	case TOP:
-		return m_top;
-
-	case BOTTOM:
-	default:
-		return m_bottom;
-	}
-}
-
-
-
 Plane& Plane::operator=(const Plane& rhs)
 {
 	// Copy rhs plane members and return current object
@@ -102,11 +55,16 @@ PLANE  operator++(PLANE& plane, int)
 }
 
 bool Frustum::Intersect(const BoxBV& collider) const
+{
+	return Intersect(collider.m_position, collider.m_boxScale);
+}
+
+bool Frustum::Intersect(const LibMath::Vector3& center, const LibMath::Vector3& extent) const
 {
 	// Check intersection on all 6 planes
 	for (PLANE plane = NEAR; plane <= BOTTOM; ++plane)
 	{
-		if (!(*this)[plane].IntersectOrForward(collider))
+		if (!(*this)[plane].IntersectOrForward(center, extent))
 			return false;
 	}
 
@@ -122,15 +80,20 @@ float Plane::FindDistance(const LibMath::Vector3& point) const
 }
 
 bool Plane::IntersectOrForward(const BoxBV& collider) const
+{
+	return IntersectOrForward(collider.m_position, collider.m_boxScale);
+}
+
+bool Plane::IntersectOrForward(const LibMath::Vector3& center, const LibMath::Vector3& extent) const
 {
 	// Project box onto plane and find interval
-	float interval = collider.m_boxScale.m_x * LibMath::absolute(m_normal.m_x) +
-				     collider.m_boxScale.m_y * LibMath::absolute(m_normal.m_y) +
-				     collider.m_boxScale.m_z * LibMath::absolute(m_normal.m_z);
+	float interval = extent.m_x * LibMath::absolute(m_normal.m_x) +
+				     extent.m_y * LibMath::absolute(m_normal.m_y) +
+				     extent.m_z * LibMath::absolute(m_normal.m_z);
 
 	/*
 		Box is inside of in front of the plane if the interval radius(minus box scale for some extra leeway)
 		is inferior to the signed distance between the AABB and the plane
 	*/
-	return -(interval + collider.m_boxScale.magnitude()) <= FindDistance(collider.m_position);
+	return -(interval + extent.magnitude()) <= FindDistance(center);
 }
@@ -0,0 +1,56 @@
+#include "PhysicsLib/FrustumCuller.h"
+#include "PhysicsLib/Frustum.h"
+
+#include "LibMath/Intersection.h"
+#include "LibMath/Vector/Vector4.h"
+
+uint32_t PhysicsLib::FrustumCuller::Add(const LibMath::Vector3& center, const LibMath::Vector3& extent)
+{
+	const uint32_t	index = static_cast<uint32_t>(m_centerX.size());
+
+	// Frustum::Intersect adds the extent length to the projected radius of every plane, added to each axis here
+	// instead, the projected radius grows by at least as much (absolute normal components sum to 1 or more)
+	const float		leeway = extent.magnitude();
+
+	m_centerX.push_back(center.m_x);
+	m_centerY.push_back(center.m_y);
+	m_centerZ.push_back(center.m_z);
+
+	m_extentX.push_back(extent.m_x + leeway);
+	m_extentY.push_back(extent.m_y + leeway);
+	m_extentZ.push_back(extent.m_z + leeway);
+
+	m_lastPlanes.push_back(0);
+	m_visible.resize(LibMath::hitMaskSize(m_centerX.size()));
+
+	return index;
+}
+
+void PhysicsLib::FrustumCuller::Clear(void)
+{
+	m_centerX.clear();
+	m_centerY.clear();
+	m_centerZ.clear();
+
+	m_extentX.clear();
+	m_extentY.clear();
+	m_extentZ.clear();
+
+	m_lastPlanes.clear();
+	m_visible.clear();
+}
+
+size_t PhysicsLib::FrustumCuller::Cull(const Frustum& frustum)
+{
+	LibMath::Vector4	planes[6];
+
+	for (PLANE plane = NEAR; plane <= BOTTOM; ++plane)
+	{
+		const Plane& current = frustum[plane];
+
+		planes[plane] = LibMath::Vector4(current.GetNormal(), current.GetDirection());
+	}
+
+	return LibMath::cullFrustumAABBs(planes, { m_centerX, m_centerY, m_centerZ }, { m_extentX, m_extentY, m_extentZ },
+									 m_lastPlanes, m_visible);
+}
@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <cmath>
+
+#include "PhysicsLib/SpatialHashGrid.h"
+
+PhysicsLib::SpatialHashGrid::SpatialHashGrid(float cellSize, uint32_t bucketCount)
+	: m_cellSize(cellSize), m_inverseCellSize(1.f / cellSize), m_buckets(bucketCount)
+{}
+
+int32_t PhysicsLib::SpatialHashGrid::CreateProxy(const LibMath::Vector3& min, const LibMath::Vector3& max, void* userData)
+{
+	int32_t proxy = m_freeList;
+
+	if (proxy == nullProxy)
+	{
+		proxy = static_cast<int32_t>(m_proxies.size());
+
+		m_proxies.emplace_back();
+		m_visited.push_back(0);
+	}
+	else
+	{
+		m_freeList = m_proxies[proxy].m_nextFree;
+		m_proxies[proxy] = Proxy();
+	}
+
+	Proxy& newProxy = m_proxies[proxy];
+
+	newProxy.m_min = min;
+	newProxy.m_max = max;
+	newProxy.m_userData = userData;
+
+	Link(proxy);
+	++m_proxyCount;
+
+	return proxy;
+}
+
+void PhysicsLib::SpatialHashGrid::DestroyProxy(int32_t proxy)
+{
+	Unlink(proxy);
+
+	m_proxies[proxy].m_free = true;
+	m_proxies[proxy].m_userData = nullptr;
+	m_proxies[proxy].m_nextFree = m_freeList;
+
+	m_freeList = proxy;
+	--m_proxyCount;
+}
+
+bool PhysicsLib::SpatialHashGrid::MoveProxy(int32_t proxy, const LibMath::Vector3& min, const LibMath::Vector3& max)
+{
+	Proxy& moved = m_proxies[proxy];
+
+	// Same cells, only the box changes
+	if (moved.m_largeIndex == nullProxy && CellsOf(min, max) == moved.m_cells)
+	{
+		moved.m_min = min;
+		moved.m_max = max;
+		return false;
+	}
+
+	Unlink(proxy);
+
+	moved.m_min = min;
+	moved.m_max = max;
+
+	Link(proxy);
+
+	return true;
+}
+
+void PhysicsLib::SpatialHashGrid::SetCellSize(float cellSize, uint32_t bucketCount)
+{
+	for (int32_t proxy = 0; proxy < static_cast<int32_t>(m_proxies.size()); ++proxy)
+	{
+		if (!m_proxies[proxy].m_free)
+			Unlink(proxy);
+	}
+
+	m_cellSize = cellSize;
+	m_inverseCellSize = 1.f / cellSize;
+
+	if (bucketCount)
+		m_buckets.assign(bucketCount, {});
+
+	m_boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+	m_boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	for (int32_t proxy = 0; proxy < static_cast<int32_t>(m_proxies.size()); ++proxy)
+	{
+		if (!m_proxies[proxy].m_free)
+			Link(proxy);
+	}
+}
+
+void PhysicsLib::SpatialHashGrid::Clear(void)
+{
+	for (std::vector<int32_t>& bucket : m_buckets)
+		bucket.clear();
+
+	m_large.clear();
+	m_proxies.clear();
+	m_visited.clear();
+
+	m_boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+	m_boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	m_freeList = nullProxy;
+	m_proxyCount = 0;
+}
+
+int32_t PhysicsLib::SpatialHashGrid::CellCoordinate(float position) const
+{
+	return static_cast<int32_t>(std::floor(position * m_inverseCellSize));
+}
+
+PhysicsLib::SpatialHashGrid::CellRange PhysicsLib::SpatialHashGrid::CellsOf(const LibMath::Vector3& min, const LibMath::Vector3& max) const
+{
+	CellRange cells;
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		cells.m_min[axis] = CellCoordinate(min[axis]);
+		cells.m_max[axis] = CellCoordinate(max[axis]);
+	}
+
+	return cells;
+}
+
+uint32_t PhysicsLib::SpatialHashGrid::BucketOf(int32_t x, int32_t y, int32_t z) const
+{
+	// Large primes, neighbour cells land in unrelated buckets
+	const uint32_t hash = (static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u) ^ (static_cast<uint32_t>(z) * 83492791u);
+
+	return hash % static_cast<uint32_t>(m_buckets.size());
+}
+
+void PhysicsLib::SpatialHashGrid::Link(int32_t proxy)
+{
+	Proxy&				linked = m_proxies[proxy];
+	const CellRange		cells = CellsOf(linked.m_min, linked.m_max);
+
+	linked.m_cells = cells;
+
+	const uint64_t		cellCount = static_cast<uint64_t>(cells.m_max[0] - cells.m_min[0] + 1) *
+									static_cast<uint64_t>(cells.m_max[1] - cells.m_min[1] + 1) *
+									static_cast<uint64_t>(cells.m_max[2] - cells.m_min[2] + 1);
+
+	if (cellCount > m_maxProxyCells)
+	{
+		linked.m_largeIndex = static_cast<int32_t>(m_large.size());
+		m_large.push_back(proxy);
+		return;
+	}
+
+	linked.m_largeIndex = nullProxy;
+
+	for (int32_t x = cells.m_min[0]; x <= cells.m_max[0]; ++x)
+	{
+		for (int32_t y = cells.m_min[1]; y <= cells.m_max[1]; ++y)
+		{
+			for (int32_t z = cells.m_min[2]; z <= cells.m_max[2]; ++z)
+				m_buckets[BucketOf(x, y, z)].push_back(proxy);
+		}
+	}
+
+	// Bounds only grow, the ray walk is clipped a bit loosely after boxes leave
+	m_boundsMin = { LibMath::min(m_boundsMin.m_x, linked.m_min.m_x), LibMath::min(m_boundsMin.m_y, linked.m_min.m_y), LibMath::min(m_boundsMin.m_z, linked.m_min.m_z) };
+	m_boundsMax = { LibMath::max(m_boundsMax.m_x, linked.m_max.m_x), LibMath::max(m_boundsMax.m_y, linked.m_max.m_y), LibMath::max(m_boundsMax.m_z, linked.m_max.m_z) };
+}
+
+void PhysicsLib::SpatialHashGrid::Unlink(int32_t proxy)
+{
+	Proxy& unlinked = m_proxies[proxy];
+
+	if (unlinked.m_largeIndex != nullProxy)
+	{
+		// Swap & pop
+		const int32_t index = unlinked.m_largeIndex;
+
+		m_large[index] = m_large.back();
+		m_proxies[m_large[index]].m_largeIndex = index;
+		m_large.pop_back();
+
+		unlinked.m_largeIndex = nullProxy;
+		return;
+	}
+
+	const CellRange& cells = unlinked.m_cells;
+
+	for (int32_t x = cells.m_min[0]; x <= cells.m_max[0]; ++x)
+	{
+		for (int32_t y = cells.m_min[1]; y <= cells.m_max[1]; ++y)
+		{
+			for (int32_t z = cells.m_min[2]; z <= cells.m_max[2]; ++z)
+			{
+				// Buckets are short, a search is enough
+				std::vector<int32_t>&	bucket = m_buckets[BucketOf(x, y, z)];
+				auto					found = std::find(bucket.begin(), bucket.end(), proxy);
+
+				*found = bucket.back();
+				bucket.pop_back();
+			}
+		}
+	}
+}
+
+void PhysicsLib::SpatialHashGrid::BeginQuery(void) const
+{
+	// Stamps wrapped around, old marks would look current
+	if (++m_queryStamp == 0)
+	{
+		std::fill(m_visited.begin(), m_visited.end(), 0u);
+		m_queryStamp = 1;
+	}
+}
+
+bool PhysicsLib::SpatialHashGrid::Visit(int32_t proxy) const
+{
+	if (m_visited[proxy] == m_queryStamp)
+		return false;
+
+	m_visited[proxy] = m_queryStamp;
+
+	return true;
+}
+
+bool PhysicsLib::SpatialHashGrid::Overlap(const Proxy& proxy, const LibMath::Vector3& min, const LibMath::Vector3& max)
+{
+	return proxy.m_min.m_x <= max.m_x && min.m_x <= proxy.m_max.m_x &&
+		   proxy.m_min.m_y <= max.m_y && min.m_y <= proxy.m_max.m_y &&
+		   proxy.m_min.m_z <= max.m_z && min.m_z <= proxy.m_max.m_z;
+}
+
+bool PhysicsLib::SpatialHashGrid::RayHit(const LibMath::Vector3& min, const LibMath::Vector3& max, const LibMath::Vector3& origin,
+										 const LibMath::Vector3& inverseDir, float& entry, float& exit)
+{
+	float maxIntersect = 1000000.f, minIntersect = -1000000.f;
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const float low = (min[axis] - origin[axis]) * inverseDir[axis];
+		const float high = (max[axis] - origin[axis]) * inverseDir[axis];
+
+		maxIntersect = LibMath::min(LibMath::max(low, high), maxIntersect);
+		minIntersect = LibMath::max(LibMath::min(low, high), minIntersect);
+	}
+
+	entry = minIntersect;
+	exit = maxIntersect;
+
+	// Touching counts, a box Ray::Intersect hits is never skipped
+	return maxIntersect >= LibMath::max(minIntersect, 0.f);
+}
@@ -0,0 +1,310 @@
+#include <algorithm>
+
+#include "PhysicsLib/SweepAndPrune.h"
+
+int32_t PhysicsLib::SweepAndPrune::CreateProxy(const LibMath::Vector3& min, const LibMath::Vector3& max, void* userData)
+{
+	int32_t proxy = m_freeList;
+
+	if (proxy == nullProxy)
+	{
+		proxy = static_cast<int32_t>(m_proxies.size());
+		m_proxies.emplace_back();
+	}
+	else
+	{
+		m_freeList = m_proxies[proxy].m_nextFree;
+		m_proxies[proxy] = Proxy();
+	}
+
+	m_proxies[proxy].m_min = min;
+	m_proxies[proxy].m_max = max;
+	m_proxies[proxy].m_userData = userData;
+
+	m_maxWidth = LibMath::max(m_maxWidth, max.m_x - min.m_x);
+
+	const uint32_t data = static_cast<uint32_t>(proxy) << 1;
+
+	// Appended after every endpoint & sorted down, boxes passed on the way are the new pairs
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		std::vector<Endpoint>& endpoints = m_axes[axis];
+
+		endpoints.push_back({ min[axis], data });
+		endpoints.push_back({ max[axis], data | 1u });
+
+		m_proxies[proxy].m_minIndex[axis] = static_cast<uint32_t>(endpoints.size()) - 2;
+		m_proxies[proxy].m_maxIndex[axis] = static_cast<uint32_t>(endpoints.size()) - 1;
+
+		SortDown(axis, m_proxies[proxy].m_minIndex[axis]);
+		SortDown(axis, m_proxies[proxy].m_maxIndex[axis]);
+	}
+
+	++m_proxyCount;
+
+	return proxy;
+}
+
+void PhysicsLib::SweepAndPrune::DestroyProxy(int32_t proxy)
+{
+	// Pairs of the proxy are the boxes overlapping it
+	std::vector<int32_t> overlapping;
+
+	Query(m_proxies[proxy].m_min, m_proxies[proxy].m_max, [&overlapping, proxy](int32_t other)
+	{
+		if (other != proxy)
+			overlapping.push_back(other);
+
+		return true;
+	});
+
+	for (int32_t other : overlapping)
+		RemovePair(proxy, other);
+
+	// Erase both endpoints & shift the ones after them, no pair changes
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		std::vector<Endpoint>&	endpoints = m_axes[axis];
+		const uint32_t			minIndex = m_proxies[proxy].m_minIndex[axis];
+
+		endpoints.erase(endpoints.begin() + m_proxies[proxy].m_maxIndex[axis]);
+		endpoints.erase(endpoints.begin() + minIndex);
+
+		for (uint32_t index = minIndex; index < endpoints.size(); ++index)
+			SetIndex(axis, index);
+	}
+
+	m_proxies[proxy].m_free = true;
+	m_proxies[proxy].m_userData = nullptr;
+	m_proxies[proxy].m_nextFree = m_freeList;
+
+	m_freeList = proxy;
+	--m_proxyCount;
+}
+
+bool PhysicsLib::SweepAndPrune::MoveProxy(int32_t proxy, const LibMath::Vector3& min, const LibMath::Vector3& max)
+{
+	Proxy&	moved = m_proxies[proxy];
+	bool	swapped = false;
+
+	// Pairs are tested against the new box while sorting
+	moved.m_min = min;
+	moved.m_max = max;
+
+	m_maxWidth = LibMath::max(m_maxWidth, max.m_x - min.m_x);
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		std::vector<Endpoint>&	endpoints = m_axes[axis];
+
+		const float		oldMin = endpoints[moved.m_minIndex[axis]].m_value;
+		const float		oldMax = endpoints[moved.m_maxIndex[axis]].m_value;
+
+		endpoints[moved.m_minIndex[axis]].m_value = min[axis];
+		endpoints[moved.m_maxIndex[axis]].m_value = max[axis];
+
+		// Grow first then shrink, the min endpoint never has to pass its own max
+		if (min[axis] < oldMin)
+			swapped |= SortDown(axis, moved.m_minIndex[axis]);
+
+		if (max[axis] > oldMax)
+			swapped |= SortUp(axis, moved.m_maxIndex[axis]);
+
+		if (min[axis] > oldMin)
+			swapped |= SortUp(axis, moved.m_minIndex[axis]);
+
+		if (max[axis] < oldMax)
+			swapped |= SortDown(axis, moved.m_maxIndex[axis]);
+	}
+
+	return swapped;
+}
+
+void PhysicsLib::SweepAndPrune::Build(void)
+{
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		std::sort(m_axes[axis].begin(), m_axes[axis].end(), Less);
+
+		for (uint32_t index = 0; index < m_axes[axis].size(); ++index)
+			SetIndex(axis, index);
+	}
+
+	m_pairs.clear();
+	m_maxWidth = 0.f;
+
+	// One sweep along x, boxes open between their min & max endpoints are tested against each new box
+	std::vector<int32_t>	open;
+	std::vector<uint32_t>	openIndex(m_proxies.size());
+
+	for (const Endpoint& endpoint : m_axes[0])
+	{
+		const int32_t proxy = endpoint.Proxy();
+
+		if (endpoint.IsMax())
+		{
+			const uint32_t index = openIndex[proxy];
+
+			open[index] = open.back();
+			openIndex[open[index]] = index;
+			open.pop_back();
+
+			continue;
+		}
+
+		for (int32_t other : open)
+		{
+			if (Overlap(proxy, other))
+				m_pairs.insert(PairKey(proxy, other));
+		}
+
+		m_maxWidth = LibMath::max(m_maxWidth, m_proxies[proxy].m_max.m_x - m_proxies[proxy].m_min.m_x);
+
+		openIndex[proxy] = static_cast<uint32_t>(open.size());
+		open.push_back(proxy);
+	}
+
+	ClearPairChanges();
+}
+
+void PhysicsLib::SweepAndPrune::Clear(void)
+{
+	for (std::vector<Endpoint>& endpoints : m_axes)
+		endpoints.clear();
+
+	m_proxies.clear();
+	m_pairs.clear();
+
+	m_maxWidth = 0.f;
+
+	ClearPairChanges();
+
+	m_freeList = nullProxy;
+	m_proxyCount = 0;
+}
+
+void PhysicsLib::SweepAndPrune::ClearPairChanges(void)
+{
+	m_addedPairs.clear();
+	m_removedPairs.clear();
+}
+
+bool PhysicsLib::SweepAndPrune::Less(const Endpoint& a, const Endpoint& b)
+{
+	return a.m_value < b.m_value || (a.m_value == b.m_value && !a.IsMax() && b.IsMax());
+}
+
+bool PhysicsLib::SweepAndPrune::SortDown(int axis, uint32_t index)
+{
+	std::vector<Endpoint>&	endpoints = m_axes[axis];
+	const uint32_t			start = index;
+
+	while (index > 0 && Less(endpoints[index], endpoints[index - 1]))
+	{
+		Swap(axis, index - 1);
+		--index;
+	}
+
+	return index != start;
+}
+
+bool PhysicsLib::SweepAndPrune::SortUp(int axis, uint32_t index)
+{
+	std::vector<Endpoint>&	endpoints = m_axes[axis];
+	const uint32_t			start = index;
+
+	while (index + 1 < endpoints.size() && Less(endpoints[index + 1], endpoints[index]))
+	{
+		Swap(axis, index);
+		++index;
+	}
+
+	return index != start;
+}
+
+void PhysicsLib::SweepAndPrune::Swap(int axis, uint32_t index)
+{
+	std::vector<Endpoint>& endpoints = m_axes[axis];
+
+	std::swap(endpoints[index], endpoints[index + 1]);
+
+	SetIndex(axis, index);
+	SetIndex(axis, index + 1);
+
+	const Endpoint& lower = endpoints[index];
+	const Endpoint& upper = endpoints[index + 1];
+
+	if (lower.Proxy() == upper.Proxy() || lower.IsMax() == upper.IsMax())
+		return;
+
+	// A min passed before a max, the boxes may now overlap on every axis
+	if (!lower.IsMax())
+	{
+		if (Overlap(lower.Proxy(), upper.Proxy()))
+			AddPair(lower.Proxy(), upper.Proxy());
+	}
+
+	// A max passed before a min, the boxes are apart on this axis
+	else
+		RemovePair(lower.Proxy(), upper.Proxy());
+}
+
+void PhysicsLib::SweepAndPrune::SetIndex(int axis, uint32_t index)
+{
+	const Endpoint&	endpoint = m_axes[axis][index];
+	Proxy&			proxy = m_proxies[endpoint.Proxy()];
+
+	if (endpoint.IsMax())
+		proxy.m_maxIndex[axis] = index;
+	else
+		proxy.m_minIndex[axis] = index;
+}
+
+bool PhysicsLib::SweepAndPrune::Overlap(int32_t proxyA, int32_t proxyB) const
+{
+	const Proxy& a = m_proxies[proxyA];
+	const Proxy& b = m_proxies[proxyB];
+
+	return a.m_min.m_x <= b.m_max.m_x && b.m_min.m_x <= a.m_max.m_x &&
+		   a.m_min.m_y <= b.m_max.m_y && b.m_min.m_y <= a.m_max.m_y &&
+		   a.m_min.m_z <= b.m_max.m_z && b.m_min.m_z <= a.m_max.m_z;
+}
+
+void PhysicsLib::SweepAndPrune::AddPair(int32_t proxyA, int32_t proxyB)
+{
+	if (m_pairs.insert(PairKey(proxyA, proxyB)).second && m_recordPairChanges)
+		m_addedPairs.push_back({ std::min(proxyA, proxyB), std::max(proxyA, proxyB) });
+}
+
+void PhysicsLib::SweepAndPrune::RemovePair(int32_t proxyA, int32_t proxyB)
+{
+	if (m_pairs.erase(PairKey(proxyA, proxyB)) && m_recordPairChanges)
+		m_removedPairs.push_back({ std::min(proxyA, proxyB), std::max(proxyA, proxyB) });
+}
+
+uint64_t PhysicsLib::SweepAndPrune::PairKey(int32_t proxyA, int32_t proxyB)
+{
+	// Same key whatever the order
+	const uint64_t low = static_cast<uint32_t>(std::min(proxyA, proxyB));
+	const uint64_t high = static_cast<uint32_t>(std::max(proxyA, proxyB));
+
+	return (low << 32) | high;
+}
+
+bool PhysicsLib::SweepAndPrune::RayHit(const LibMath::Vector3& min, const LibMath::Vector3& max, const LibMath::Vector3& origin,
+									   const LibMath::Vector3& inverseDir, float maxDistance)
+{
+	float maxIntersect = 1000000.f, minIntersect = -1000000.f;
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const float low = (min[axis] - origin[axis]) * inverseDir[axis];
+		const float high = (max[axis] - origin[axis]) * inverseDir[axis];
+
+		maxIntersect = LibMath::min(LibMath::max(low, high), maxIntersect);
+		minIntersect = LibMath::max(LibMath::min(low, high), minIntersect);
+	}
+
+	// Touching counts, a box Ray::Intersect hits is never skipped
+	return maxIntersect >= LibMath::max(minIntersect, 0.f) && minIntersect <= maxDistance;
+}
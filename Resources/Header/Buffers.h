@@ -42,6 +42,22 @@ public:
 		glBindBuffer(Type, 0);
 	}
 
+	// Generate OpenGL vertex buffer and feed it with raw bytes (packed vertices)
+	Buffer(size_t size, const void* values, bool dynamic = false)
+	{
+		glGenBuffers(1, &m_id);
+		glBindBuffer(Type, m_id);
+
+		// Init data according to usage (static/dynamic)
+		if (dynamic)
+			glBufferData(Type, size, values, GL_DYNAMIC_DRAW);
+		else
+			glBufferData(Type, size, values, GL_STATIC_DRAW);
+
+		// Unbind buffer
+		glBindBuffer(Type, 0);
+	}
+
 	// Generate OpenGL vertex buffer and feed it with data
 	Buffer(size_t  size, const float* values, bool dynamic = false)
 	{
@@ -159,8 +175,9 @@ public:
 	// Delete VAO and associated buffers
 	void Delete();
 
-	// Set and enable vertex attribute from a VBO
-	void SetAttrib(const Buffer<VBO>& vbo, unsigned int pos, int size, int stride, void* offset);
+	// Set and enable vertex attribute from a VBO, integer types can be normalized to [0, 1] or [-1, 1]
+	void SetAttrib(const Buffer<VBO>& vbo, unsigned int pos, int size, int stride, void* offset,
+				   unsigned int type = GL_FLOAT, bool normalized = false);
 
 	// Number of vertices
 	int				m_vertexCount = 0;
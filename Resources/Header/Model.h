@@ -8,6 +8,7 @@
 
 #include "ResourceManager.h"
 #include "Vertex.h"
+#include "VertexLayout.h"
 #include "Buffers.h"
 
 #include "Textures.h"
@@ -25,14 +26,14 @@ public:
 	// Empty model
 	Model(void) = default;
 
-	// Open obj file and load it into RAM
-	Model(const std::string& path);
+	// Open obj file and load it into RAM, packing picks the VBO vertex layout
+	Model(const std::string& path, VertexLayout::Packing packing = VertexLayout::Packing::SMALLEST);
 
 	// Delete buffers and destroy objects
 	~Model(void) override;
 
 	// Create VBO, EBO and VAO from stored data
-	void			CreateVAO();
+	void			CreateVAO(VertexLayout::Packing packing = VertexLayout::Packing::SMALLEST);
 
 	// Create only VBO from stored data
 	VertexBuffer	CreateVBO(VAO& vao);
@@ -40,12 +41,21 @@ public:
 	// Create only index buffer from stored data
 	IndexBuffer		CreateEBO(VAO& vao);
 
+	// Model matrix to draw with from the node's global transform (adds the position decode if any)
+	LibMath::Matrix4	DrawTransform(const LibMath::Matrix4& globalTransform) const;
+
 	// Vertex data and indices
 	std::vector<Vertex>		m_vertices;
 	std::vector<uint32_t>	m_indices;
 
 	Texture*				m_texture = nullptr;
 
+	// Layout of the vertices in the VBO
+	VertexLayout			m_layout;
+
+	// Put in front of the model matrix when drawing, identity unless positions are quantized
+	LibMath::Matrix4		m_positionDecode;
+
 	// Store buffer objects for easier drawings
 
 	VertexAttributes		m_vao = 0;
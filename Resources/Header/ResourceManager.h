@@ -3,6 +3,8 @@
 #include <unordered_map>
 #include <string>
 
+#include "Key.hpp"
+
 // Base class dor resources
 class IResource
 {
@@ -28,6 +30,13 @@ public:
     // Retrieve resource as its original type from its key
     template<class ValT>
     ValT* Get(const std::string& key)
+    {
+        return Get<ValT>(Key(key));
+    }
+
+    // Retrieve resource without hashing its name, e.g. Get<Shader>("lighting shader"_key)
+    template<class ValT>
+    ValT* Get(Key key)
     {
         // Get iterator to resource
        auto found = m_resources.find(key);
@@ -55,7 +64,7 @@ public:
         resource = new ValT(key, args...);
 
         // Assign new resource
-        m_resources[key] = dynamic_cast<IResource*>(resource);
+        m_resources[Key(key)] = dynamic_cast<IResource*>(resource);
 
         return resource;
     }
@@ -66,6 +75,6 @@ public:
 private:
 
     // Store resources
-    std::unordered_map<std::string, IResource*> m_resources;
+    std::unordered_map<Key, IResource*> m_resources;
 
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include "Vertex.h"
+
+/*
+	GPU side layout of a model's vertices. The importer still produces full
+	float Vertex objects, the layout decides how they are packed in the VBO &
+	describes the matching attribute pointers.
+
+	Packed attributes:
+	- position: 4 halfs, or 4 unsigned shorts normalized over the mesh bounds
+	  (the bounds are given back as a decode matrix to put in front of the model matrix)
+	- normal: signed 10_10_10_2, read by the shader as a normalized vec3
+	- uv: 2 unsigned shorts normalized to [0, 1]
+
+	Every packed format is only picked if the mesh's data survives it,
+	the attribute falls back to floats otherwise. Shaders are unchanged
+*/
+
+class VertexLayout
+{
+public:
+
+	enum class PositionFormat : uint8_t
+	{
+		FLOAT,
+		HALF,
+		UNORM16
+	};
+
+	enum class NormalFormat : uint8_t
+	{
+		FLOAT,
+		INT_2_10_10_10
+	};
+
+	enum class TextureUVFormat : uint8_t
+	{
+		FLOAT,
+		UNORM16
+	};
+
+	enum class Packing : uint8_t
+	{
+		// 32 bytes per vertex, same as Vertex
+		FULL,
+
+		// Smallest formats within tolerance, 16 bytes per vertex at best
+		SMALLEST
+	};
+
+	// Full float layout
+	VertexLayout(void) = default;
+
+	// Pick the smallest formats the vertices survive, positions must stay within tolerance (in model units)
+	static VertexLayout		Select(const std::vector<Vertex>& vertices, Packing packing, float tolerance = 1e-3f);
+
+	// Bytes per vertex
+	int						Stride(void) const;
+
+	// Pack vertices into a VBO ready buffer
+	std::vector<uint8_t>	Pack(const std::vector<Vertex>& vertices) const;
+
+	// Matrix turning stored positions into model positions, identity unless positions are UNORM16
+	LibMath::Matrix4		PositionDecode(void) const;
+
+	// Attribute layout for SetAttrib
+	struct Attribute
+	{
+		unsigned int		m_location;
+		int					m_components;
+		unsigned int		m_type;
+		bool				m_normalized;
+		int					m_offset;
+	};
+
+	Attribute				PositionAttribute(void) const;
+	Attribute				NormalAttribute(void) const;
+	Attribute				TextureUVAttribute(void) const;
+
+	PositionFormat			m_position = PositionFormat::FLOAT;
+	NormalFormat			m_normal = NormalFormat::FLOAT;
+	TextureUVFormat			m_textureUV = TextureUVFormat::FLOAT;
+
+	// Mesh bounds UNORM16 positions are quantized against
+	LibMath::Vector3		m_boundsMin;
+	LibMath::Vector3		m_boundsExtent;
+
+private:
+
+	int						PositionSize(void) const;
+	int						NormalSize(void) const;
+};
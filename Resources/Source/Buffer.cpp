@@ -13,13 +13,14 @@ VertexAttributes::VertexAttributes(unsigned int id)
 {}
 
 
-void VertexAttributes::SetAttrib(const Buffer<VBO>& vbo, unsigned int pos, int size, int stride, void* offset)
+void VertexAttributes::SetAttrib(const Buffer<VBO>& vbo, unsigned int pos, int size, int stride, void* offset,
+								 unsigned int type, bool normalized)
 {
 	// Bind VAO
 	vbo.Bind();
 
 	// Set attrib pointer
-	glVertexAttribPointer(pos, size, GL_FLOAT, GL_FALSE, stride, offset);
+	glVertexAttribPointer(pos, size, type, normalized ? GL_TRUE : GL_FALSE, stride, offset);
 
 	// Enable attrib
 	glEnableVertexAttribArray(pos);
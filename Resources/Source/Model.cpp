@@ -6,7 +6,7 @@
 #include "Model.h"
 #include "ModelImporter.h"
 
-Model::Model(const std::string& path)
+Model::Model(const std::string& path, VertexLayout::Packing packing)
 {
     // Add subfolder path
     std::string relativePath("assets/meshes/");
@@ -20,7 +20,7 @@ Model::Model(const std::string& path)
     if (!ImportWavefront(relativePath))
         std::cout << "Cannot open model file '" << path << "'" << std::endl;
 
-    CreateVAO();
+    CreateVAO(packing);
 }
 
 
@@ -51,14 +51,20 @@ VertexBuffer Model::CreateVBO(VAO& vao)
     if (!vao.m_vertexCount)
         vao.m_vertexCount += count;
 
-    // Create VBO and set data
-    VertexBuffer vbo(count * sizeof(Vertex), &(m_vertices[0].m_position.m_x));
+    // Pack vertices in the selected layout and create VBO
+    std::vector<uint8_t>    packed = m_layout.Pack(m_vertices);
+    VertexBuffer            vbo(packed.size(), static_cast<const void*>(packed.data()));
 
+    int                     stride = m_layout.Stride();
 
     // Set and enable position, normals and texture coordinates
-    vao.SetAttrib(vbo, 0, 3, 8 * sizeof(float), NULL);
-    vao.SetAttrib(vbo, 1, 3, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    vao.SetAttrib(vbo, 2, 2, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+    for (const VertexLayout::Attribute& attribute :
+         { m_layout.PositionAttribute(), m_layout.NormalAttribute(), m_layout.TextureUVAttribute() })
+    {
+        vao.SetAttrib(vbo, attribute.m_location, attribute.m_components, stride,
+                      reinterpret_cast<void*>(static_cast<uintptr_t>(attribute.m_offset)),
+                      attribute.m_type, attribute.m_normalized);
+    }
 
     vao.Unbind();
 
@@ -88,6 +94,15 @@ IndexBuffer Model::CreateEBO(VAO& vao)
     return vao.m_ebo;
 }
 
+LibMath::Matrix4 Model::DrawTransform(const LibMath::Matrix4& globalTransform) const
+{
+    // Quantized positions are brought back to model space before the node's transform
+    if (m_layout.m_position == VertexLayout::PositionFormat::UNORM16)
+        return m_positionDecode * globalTransform;
+
+    return globalTransform;
+}
+
 bool Model::ImportWavefront(const std::filesystem::path& path)
 {
     WavefrontImporter reader(this);
@@ -95,8 +110,12 @@ bool Model::ImportWavefront(const std::filesystem::path& path)
     return reader.LoadModel(path);
 }
 
-void Model::CreateVAO()
+void Model::CreateVAO(VertexLayout::Packing packing)
 {
+    // Pick the smallest layout the vertices survive
+    m_layout = VertexLayout::Select(m_vertices, packing);
+    m_positionDecode = m_layout.PositionDecode();
+
     // Create VAO
     m_vao = VertexAttributes();
 
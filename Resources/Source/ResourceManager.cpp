@@ -3,7 +3,7 @@
 #include "ResourceManager.h"
 
 // Alias for readability
-using Resource = std::pair<const std::string, IResource*>;
+using Resource = std::pair<const Key, IResource*>;
 
 ResourceManager::~ResourceManager()
 {
@@ -29,9 +29,9 @@ ResourceManager::~ResourceManager()
 void ResourceManager::Delete(const std::string& key)
 {
     // Find resource if it exists
-    auto resourceIt = m_resources.find(key);
+    auto resourceIt = m_resources.find(Key(key));
 
-    if (resourceIt->second)
+    if (resourceIt != m_resources.end() && resourceIt->second)
     {
         // Delete value
         delete resourceIt->second;
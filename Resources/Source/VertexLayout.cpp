@@ -0,0 +1,271 @@
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+#include "glad/glad.h"
+
+#include "LibMath/Arithmetic.h"
+
+#include "VertexLayout.h"
+
+namespace
+{
+	// Float to IEEE half, round to nearest even (no F16C dependency)
+	uint16_t FloatToHalf(float value)
+	{
+		const uint32_t	bits = std::bit_cast<uint32_t>(value);
+		const uint32_t	sign = (bits >> 16) & 0x8000u;
+		const uint32_t	absolute = bits & 0x7FFFFFFFu;
+
+		// Infinity & NaN
+		if (absolute >= 0x7F800000u)
+			return static_cast<uint16_t>(sign | 0x7C00u | (absolute > 0x7F800000u ? 0x200u : 0u));
+
+		// Too large, rounds to infinity
+		if (absolute >= 0x477FF000u)
+			return static_cast<uint16_t>(sign | 0x7C00u);
+
+		// Subnormal half, count in steps of 2^-24
+		if (absolute < 0x38800000u)
+			return static_cast<uint16_t>(sign | static_cast<uint32_t>(std::nearbyint(std::bit_cast<float>(absolute) * 16777216.f)));
+
+		// Rebias exponent & round the 13 dropped mantissa bits
+		return static_cast<uint16_t>(sign | ((absolute - 0x38000000u + 0xFFFu + ((absolute >> 13) & 1u)) >> 13));
+	}
+
+	float HalfToFloat(uint16_t half)
+	{
+		const uint32_t	sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+		const uint32_t	exponent = (half >> 10) & 0x1Fu;
+		const uint32_t	mantissa = half & 0x3FFu;
+
+		if (exponent == 0)
+			return std::bit_cast<float>(sign | std::bit_cast<uint32_t>(static_cast<float>(mantissa) / 16777216.f));
+
+		if (exponent == 31)
+			return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+
+		return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+	}
+
+	uint16_t ToUnorm16(float value)
+	{
+		value = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+
+		return static_cast<uint16_t>(value * 65535.f + 0.5f);
+	}
+
+	// Value in [-1, 1] to a 10 bit two's complement field
+	uint32_t ToSnorm10(float value)
+	{
+		value = value < -1.f ? -1.f : (value > 1.f ? 1.f : value);
+
+		return static_cast<uint32_t>(static_cast<int32_t>(std::lround(value * 511.f))) & 0x3FFu;
+	}
+
+	// x in the low bits, w (unused) left at 0
+	uint32_t PackNormal(const LibMath::Vector3& normal)
+	{
+		return ToSnorm10(normal.m_x) | (ToSnorm10(normal.m_y) << 10) | (ToSnorm10(normal.m_z) << 20);
+	}
+
+	// Position relative to the mesh bounds, 0 on flat axes
+	float ToBounds(float value, float min, float extent)
+	{
+		return extent > 0.f ? (value - min) / extent : 0.f;
+	}
+
+	float FromUnorm16(uint16_t value, float min, float extent)
+	{
+		return min + static_cast<float>(value) / 65535.f * extent;
+	}
+}
+
+VertexLayout VertexLayout::Select(const std::vector<Vertex>& vertices, Packing packing, float tolerance)
+{
+	VertexLayout	layout;
+
+	if (packing == Packing::FULL || vertices.empty())
+		return layout;
+
+	LibMath::Vector3	min = vertices[0].m_position;
+	LibMath::Vector3	max = vertices[0].m_position;
+	bool				unitNormals = true;
+	bool				unitUVs = true;
+
+	for (const Vertex& vertex : vertices)
+	{
+		const LibMath::Vector3& position = vertex.m_position;
+
+		min = LibMath::Vector3(LibMath::min(min.m_x, position.m_x), LibMath::min(min.m_y, position.m_y), LibMath::min(min.m_z, position.m_z));
+		max = LibMath::Vector3(LibMath::max(max.m_x, position.m_x), LibMath::max(max.m_y, position.m_y), LibMath::max(max.m_z, position.m_z));
+
+		for (float component : { vertex.m_normal.m_x, vertex.m_normal.m_y, vertex.m_normal.m_z })
+			unitNormals &= component >= -1.f && component <= 1.f;
+
+		// Repeating textures need coordinates outside of [0, 1]
+		for (float component : { vertex.m_textureUV.m_x, vertex.m_textureUV.m_y })
+			unitUVs &= component >= 0.f && component <= 1.f;
+	}
+
+	layout.m_boundsMin = min;
+	layout.m_boundsExtent = max - min;
+
+	// Largest error of each position format
+	float	halfError = 0.f;
+	float	unormError = 0.f;
+
+	for (const Vertex& vertex : vertices)
+	{
+		const float	values[3] = { vertex.m_position.m_x, vertex.m_position.m_y, vertex.m_position.m_z };
+		const float	mins[3] = { min.m_x, min.m_y, min.m_z };
+		const float	extents[3] = { layout.m_boundsExtent.m_x, layout.m_boundsExtent.m_y, layout.m_boundsExtent.m_z };
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float		value = values[axis];
+			const uint16_t	quantized = ToUnorm16(ToBounds(value, mins[axis], extents[axis]));
+
+			halfError = LibMath::max(halfError, std::fabs(HalfToFloat(FloatToHalf(value)) - value));
+			unormError = LibMath::max(unormError, std::fabs(FromUnorm16(quantized, mins[axis], extents[axis]) - value));
+		}
+	}
+
+	// Halfs keep the model matrix as is, prefer them when precise enough
+	if (halfError <= tolerance)
+		layout.m_position = PositionFormat::HALF;
+
+	else if (unormError <= tolerance)
+		layout.m_position = PositionFormat::UNORM16;
+
+	if (unitNormals)
+		layout.m_normal = NormalFormat::INT_2_10_10_10;
+
+	if (unitUVs)
+		layout.m_textureUV = TextureUVFormat::UNORM16;
+
+	return layout;
+}
+
+int VertexLayout::PositionSize(void) const
+{
+	// Packed positions carry a 4th component to keep attributes 4 byte aligned
+	return m_position == PositionFormat::FLOAT ? 3 * sizeof(float) : 4 * sizeof(uint16_t);
+}
+
+int VertexLayout::NormalSize(void) const
+{
+	return m_normal == NormalFormat::FLOAT ? 3 * sizeof(float) : sizeof(uint32_t);
+}
+
+int VertexLayout::Stride(void) const
+{
+	const int textureUVSize = m_textureUV == TextureUVFormat::FLOAT ? 2 * sizeof(float) : 2 * sizeof(uint16_t);
+
+	return PositionSize() + NormalSize() + textureUVSize;
+}
+
+std::vector<uint8_t> VertexLayout::Pack(const std::vector<Vertex>& vertices) const
+{
+	const int				stride = Stride();
+	std::vector<uint8_t>	buffer(vertices.size() * stride);
+	uint8_t*				write = buffer.data();
+
+	for (const Vertex& vertex : vertices)
+	{
+		uint8_t* attribute = write;
+
+		switch (m_position)
+		{
+		case PositionFormat::HALF:
+		{
+			// w = 1.0
+			const uint16_t position[4] = { FloatToHalf(vertex.m_position.m_x), FloatToHalf(vertex.m_position.m_y),
+										   FloatToHalf(vertex.m_position.m_z), 0x3C00u };
+
+			std::memcpy(attribute, position, sizeof(position));
+			break;
+		}
+
+		case PositionFormat::UNORM16:
+		{
+			const uint16_t position[4] =
+			{
+				ToUnorm16(ToBounds(vertex.m_position.m_x, m_boundsMin.m_x, m_boundsExtent.m_x)),
+				ToUnorm16(ToBounds(vertex.m_position.m_y, m_boundsMin.m_y, m_boundsExtent.m_y)),
+				ToUnorm16(ToBounds(vertex.m_position.m_z, m_boundsMin.m_z, m_boundsExtent.m_z)),
+				0xFFFFu
+			};
+
+			std::memcpy(attribute, position, sizeof(position));
+			break;
+		}
+
+		default:
+			std::memcpy(attribute, &vertex.m_position.m_x, 3 * sizeof(float));
+			break;
+		}
+
+		attribute += PositionSize();
+
+		if (m_normal == NormalFormat::INT_2_10_10_10)
+		{
+			const uint32_t normal = PackNormal(vertex.m_normal);
+
+			std::memcpy(attribute, &normal, sizeof(normal));
+		}
+		else
+			std::memcpy(attribute, &vertex.m_normal.m_x, 3 * sizeof(float));
+
+		attribute += NormalSize();
+
+		if (m_textureUV == TextureUVFormat::UNORM16)
+		{
+			const uint16_t textureUV[2] = { ToUnorm16(vertex.m_textureUV.m_x), ToUnorm16(vertex.m_textureUV.m_y) };
+
+			std::memcpy(attribute, textureUV, sizeof(textureUV));
+		}
+		else
+			std::memcpy(attribute, &vertex.m_textureUV.m_x, 2 * sizeof(float));
+
+		write += stride;
+	}
+
+	return buffer;
+}
+
+LibMath::Matrix4 VertexLayout::PositionDecode(void) const
+{
+	if (m_position != PositionFormat::UNORM16)
+		return LibMath::Matrix4();
+
+	// Row vectors: scale by the extent, then move to the bounds' corner
+	return LibMath::Matrix4::Scale(m_boundsExtent) * LibMath::Matrix4::Translate(m_boundsMin);
+}
+
+VertexLayout::Attribute VertexLayout::PositionAttribute(void) const
+{
+	switch (m_position)
+	{
+	case PositionFormat::HALF:		return { 0, 4, GL_HALF_FLOAT, false, 0 };
+	case PositionFormat::UNORM16:	return { 0, 4, GL_UNSIGNED_SHORT, true, 0 };
+	default:						return { 0, 3, GL_FLOAT, false, 0 };
+	}
+}
+
+VertexLayout::Attribute VertexLayout::NormalAttribute(void) const
+{
+	// 10_10_10_2 has to be read as 4 components, the shader's vec3 drops w
+	if (m_normal == NormalFormat::INT_2_10_10_10)
+		return { 1, 4, GL_INT_2_10_10_10_REV, true, PositionSize() };
+
+	return { 1, 3, GL_FLOAT, false, PositionSize() };
+}
+
+VertexLayout::Attribute VertexLayout::TextureUVAttribute(void) const
+{
+	if (m_textureUV == TextureUVFormat::UNORM16)
+		return { 2, 2, GL_UNSIGNED_SHORT, true, PositionSize() + NormalSize() };
+
+	return { 2, 2, GL_FLOAT, false, PositionSize() + NormalSize() };
+}
@@ -64,13 +64,17 @@ public:
 	// Boolean
 	bool	IsHit(const Ray& ray, Color& playerColor);
 
+	// Level snapshot, color & movement progress
+	void	SaveState(SnapshotBuffer& buffer) const override;
+	bool	LoadState(SnapshotBuffer& buffer) override;
+
 	// Variables
 	Material		m_mat;
 	Color			m_color;
 
-	Mesh*			m_mesh		= nullptr;
-	ColBoxBV*		m_collider	= nullptr;
-	PointLight*		m_light		= nullptr;
+	Handle<Mesh>			m_mesh;
+	Handle<ColBoxBV>		m_collider;
+	Handle<PointLight>		m_light;
 
 private:
 	BlockMovement*	m_movement	= nullptr;
@@ -165,39 +169,39 @@ private:
 
 	void UpdateStartPoint(void)
 	{
-		// Create a matrix for the transformation of the mesh
-		LibMath::Matrix4& meshTransform = m_blockMesh->m_sceneNode->m_globalTransform; 
+		// Get the translation of the mesh node
+		LibMath::Vector3& translation = m_blockMesh->m_sceneNode->m_translation; 
 
 		// Switch between the different directions
 		switch (m_order[m_currentDir]) 
 		{
 		case RIGHT:
-			m_startPoint = meshTransform.m_matrix[3][0];
+			m_startPoint = translation.m_x;
 			m_speed = LibMath::absolute(m_speed);
 			break;
 
 		case UP:
-			m_startPoint = meshTransform.m_matrix[3][1];
+			m_startPoint = translation.m_y;
 			m_speed = LibMath::absolute(m_speed);
 			break;
 
 		case FORWARD:
-			m_startPoint = meshTransform.m_matrix[3][2];
+			m_startPoint = translation.m_z;
 			m_speed = LibMath::absolute(m_speed);
 			break;
 
 		case LEFT:
-			m_startPoint = meshTransform.m_matrix[3][0];
+			m_startPoint = translation.m_x;
 			m_speed = LibMath::absolute(m_speed) * -1;
 			break;
 
 		case DOWN:
-			m_startPoint = meshTransform.m_matrix[3][1];
+			m_startPoint = translation.m_y;
 			m_speed = LibMath::absolute(m_speed) * -1;
 			break;
 
 		case BACKWARD:
-			m_startPoint = meshTransform.m_matrix[3][2];
+			m_startPoint = translation.m_z;
 			m_speed = LibMath::absolute(m_speed) * -1;
 			break;
 
@@ -249,7 +253,7 @@ private:
 
 	// Variables
 	BLOCK_DIRECTION	m_order[NUM_OF_DIR] = { LEFT, RIGHT, LEFT, RIGHT, LEFT, RIGHT };
-	Mesh*			m_blockMesh			= nullptr;
+	Handle<Mesh>	m_blockMesh;
 	float			m_speed				= 12.f;
 	float			m_pathLength		= 1.f;
 	float			m_startPoint		= 0.f;
@@ -60,7 +60,7 @@ public:
 	static Color*	m_playerColor;
 	Material		m_mat;
 	Color			m_doorColor;
-	BoxBV*			m_collider		= nullptr;
+	Handle<BoxBV>	m_collider;
 	Mesh*			m_mesh			= nullptr;
 
 }; // !Class Door
\ No newline at end of file
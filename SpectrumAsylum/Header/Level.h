@@ -16,7 +16,24 @@ public:
 	// Destructor
 	~Level(void) = default;
 
+	// Save transforms & gameplay state once the level is loaded, GPU resources are not part of it
+	void	CaptureSnapshot(void);
+
+	// Put the level back in the captured state without reloading anything
+	// Return false if nothing was captured, nodes were added or removed since or the data does not match,
+	// the level may then be partly restored & should be loaded again
+	bool	RestoreSnapshot(void);
+
 	ResourceManager		m_assets;
 	BVHierarchy			m_colliders;
+	// Per type arrays of the scene objects, declared before the scene so it outlives the nodes
+	SceneComponents		m_components;
+	// Tree storage, a level holds a few hundred nodes, flat storage pays off in the tens of thousands (HotLoopBench)
 	Graph<SceneNode>	m_scene;
+
+	SnapshotBuffer		m_snapshot;
+
+private:
+	// Hash of the keys & types of every node, a snapshot only fits the graphs it was taken from
+	uint64_t			LayoutHash(void) const;
 };
\ No newline at end of file
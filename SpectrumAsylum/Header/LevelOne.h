@@ -15,7 +15,10 @@ void UpdateSound(Game& game);
 // Load assets and build level
 void InitLevelOne(Game& game);
 
-// Place broad bounding volumes
+// Restore level one to its state right after loading, reload it if that fails
+void RestartLevelOne(Game& game);
+
+// Place area volumes grouping colliders
 void InitColliders(BVHierarchy& colliders);
 
 // Place game objects into scene
@@ -40,8 +40,12 @@ public:
 	// Update player movement & rotation
 	void		UpdatePlayer(Application& window, float deltaTime, BVHierarchy& colliders);
 
-	// Cast a ray from the current player coordinates
-	void		CastRay(Collider* collider, BoxBV*& outBox, float& outDistance);
+	// Test the player's color ray against a collider, keep the closest box hit
+	void		CastRay(const Ray& ray, Collider* collider, BoxBV*& outBox, float& outDistance);
+
+	// Level snapshot, movement & phone color
+	void		SaveState(SnapshotBuffer& buffer) const override;
+	bool		LoadState(SnapshotBuffer& buffer) override;
 
 	Camera*							m_camera;
 	PhysicsLib::SphereCollider*		m_collider;
@@ -58,6 +62,14 @@ private:
 	float		m_lastYPosition;
 	float		m_playerHeight;
 
+	// Colliders near the player & along the color ray, reused between frames
+	std::vector<BVHierarchy::BVNode*>	m_prunedColliders;
+	std::vector<BVHierarchy::BVNode*>	m_rayColliders;
+
+	// Light boxes & final tower the player is inside, this frame & the last
+	std::vector<Handle<BVHierarchy::BVNode>>	m_insideVolumes;
+	std::vector<Handle<BVHierarchy::BVNode>>	m_lastInsideVolumes;
+
 public:
 	bool		m_isGrounded;
 	bool		m_isTeleported = false;
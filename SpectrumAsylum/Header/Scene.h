@@ -6,11 +6,8 @@
 #include "Graph.hpp"
 #include "SceneNode.hpp"
 
-// Display mesh in level
-void	ParseScene(Graph<SceneNode>& gameObjects, Shader* shader, Camera* camera, const float deltaTime);
-
-// Update nodes
-void	ProcessNode(SceneNode* node, Shader* shader, std::vector<Mesh*>& meshes, const float deltaTime);
+// Update scene objects & display meshes in level
+void	ParseScene(const SceneComponents& components, Shader* shader, Camera* camera, const float deltaTime);
 
 // Set uniforms for mesh
 void	DrawMesh(Mesh* mesh, Shader* shader, const LibMath::Matrix4& viewProjection);
@@ -73,7 +73,7 @@ ColBoxBV* ColorBlock::CreateCollider(BVHierarchy& colliders, const char* key, co
 	// Apply the color of the block to the collider
 	m_collider->m_color = &m_color;
 
-	return m_collider;
+	return m_collider.Get();
 
 }
 
@@ -101,7 +101,7 @@ Mesh* ColorBlock::CreateMesh(Graph<SceneNode>& gameObjects, const char* colorBox
 	// Give him a material
 	m_mesh->m_material = &m_mat;
 
-	return m_mesh;
+	return m_mesh.Get();
 }
 
 
@@ -166,7 +166,7 @@ void ColorBlock::SetMovement(float speed, float length)
 	else if (m_mesh)
 	{
 		// Then create a movement
-		m_movement = new BlockMovement(speed, length, m_mesh);
+		m_movement = new BlockMovement(speed, length, m_mesh.Get());
 	}
 }
 
@@ -194,7 +194,7 @@ void ColorBlock::SetMovement(float speed, float length, BLOCK_DIRECTION directio
 	else if (m_mesh)
 	{
 		// Then create a movement
-		m_movement = new BlockMovement(speed, length, directions, m_mesh);
+		m_movement = new BlockMovement(speed, length, directions, m_mesh.Get());
 	}
 }
 
@@ -224,7 +224,7 @@ void ColorBlock::SetMovement(float speed, float length, BLOCK_DIRECTION dir1, BL
 	else if (m_mesh)
 	{
 		// Then create a movement
-		m_movement = new BlockMovement(speed, length, dir1, dir2, m_mesh);
+		m_movement = new BlockMovement(speed, length, dir1, dir2, m_mesh.Get());
 	}
 }
 
@@ -239,33 +239,71 @@ void ColorBlock::UpdateMovement(const float deltaTime)
 	if (!m_movement || !m_mesh)
 		return;
 
-	// Create a matrix 4 to apply transformation of mesh
-	LibMath::Matrix4&	meshTransform = m_mesh->m_sceneNode->m_globalTransform;
+	// Move the mesh node translation, its matrices are rebuilt on the next graph update
+	SceneNode*			meshNode = m_mesh->m_sceneNode;
+	LibMath::Vector3&	translation = meshNode->m_translation;
+
+	meshNode->MarkDirty();
 
 	// Switch between the different direction to apply different transformation
 	switch (m_movement->m_order[m_movement->m_currentDir])
 	{
-	// For left and right use this matrix
+	// For left and right use this axis
 	case LEFT:
 	case RIGHT:
-		m_movement->UpdateAxis(meshTransform.m_matrix[3][0], deltaTime);
+		m_movement->UpdateAxis(translation.m_x, deltaTime);
 		break;
 
-	// For up and down use this matrix
+	// For up and down use this axis
 	case UP:
 	case DOWN:
-		m_movement->UpdateAxis(meshTransform.m_matrix[3][1], deltaTime);
+		m_movement->UpdateAxis(translation.m_y, deltaTime);
 		break;
 
-	// For forward and backward use this matrix
+	// For forward and backward use this axis
 	case FORWARD:
 	case BACKWARD:
-		m_movement->UpdateAxis(meshTransform.m_matrix[3][2], deltaTime);
+		m_movement->UpdateAxis(translation.m_z, deltaTime);
 		break;
 	}
 }
 
 
+/**********\
+* Snapshot *
+\**********/
+
+// Save block color & where the block is along its path, the mesh node saves the translation
+void ColorBlock::SaveState(SnapshotBuffer& buffer) const
+{
+	buffer.Write(m_color.m_red);
+	buffer.Write(m_color.m_green);
+	buffer.Write(m_color.m_blue);
+	buffer.Write(m_color.m_alpha);
+
+	if (m_movement)
+	{
+		buffer.Write(m_movement->m_speed);
+		buffer.Write(m_movement->m_startPoint);
+		buffer.Write(m_movement->m_currentDir);
+	}
+}
+
+bool ColorBlock::LoadState(SnapshotBuffer& buffer)
+{
+	bool read = buffer.Read(m_color.m_red) && buffer.Read(m_color.m_green) &&
+				buffer.Read(m_color.m_blue) && buffer.Read(m_color.m_alpha);
+
+	if (m_movement)
+	{
+		read = read && buffer.Read(m_movement->m_speed) && buffer.Read(m_movement->m_startPoint) &&
+			   buffer.Read(m_movement->m_currentDir);
+	}
+
+	return read;
+}
+
+
 /*********\
 * Boolean *
 \*********/
@@ -45,7 +45,7 @@ BoxBV* Door::CreateCollider(BVHierarchy& colliders, const char* key, const char*
 	else
 		m_collider = colliders.AddCollider<BoxBV>(std::string(key), m_mesh->m_position, m_mesh->m_scale);
 
-	return m_collider;
+	return m_collider.Get();
 }
 
 // Create the door mesh
@@ -57,7 +57,7 @@ Mesh* Game::CreateBlock(const std::string& key, Model* model, const char* modelS
 	block->m_material = mat;
 
 	// Add a collider for the wall
-	m_currentLevel.m_colliders.AddCollider<BoxBV>(areaKey, key);
+	m_currentLevel.m_colliders.AddStaticCollider<BoxBV>(areaKey, key);
 
 	// Link to the scene node wall colliders
 	m_currentLevel.m_colliders.LinkToNode(m_currentLevel.m_scene, key, key);
@@ -85,7 +85,7 @@ Mesh* Game::CreateWallWithHole(const std::string& key, Model* model, const char*
 	wall->m_material = mat;
 
 	// Create a specific collider for the wall with hole
-	PhysicsLib::HoledCollider* collider = m_currentLevel.m_colliders.AddCollider<PhysicsLib::HoledCollider>(areaKey, key, pos, scale, PhysicsLib::HOLED);
+	PhysicsLib::HoledCollider* collider = m_currentLevel.m_colliders.AddStaticCollider<PhysicsLib::HoledCollider>(areaKey, key, pos, scale, PhysicsLib::HOLED);
 
 	// Link to the scene node wall colliders
 	m_currentLevel.m_colliders.LinkToNode(m_currentLevel.m_scene, key, key);
@@ -95,7 +95,7 @@ Mesh* Game::CreateWallWithHole(const std::string& key, Model* model, const char*
 	m_sceneFile << holeKey << "\n\n";
 
 	// Add a collider for the wall
-	collider->m_hole = m_currentLevel.m_colliders.AddCollider<BoxBV>(areaKey, holeKey, pos, LibMath::Vector3{1.f, 1.f, 1.f}, PhysicsLib::IGNORE);
+	collider->m_hole = m_currentLevel.m_colliders.AddStaticCollider<BoxBV>(areaKey, holeKey, pos, LibMath::Vector3{1.f, 1.f, 1.f}, PhysicsLib::IGNORE);
 
 	return wall;
 }
@@ -120,7 +120,7 @@ Mesh* Game::CreateFloor(const std::string& key, Model* model, const char* modelS
 	block->m_material = mat;
 
 	// Add a collider for the wall
-	m_currentLevel.m_colliders.AddCollider<BoxBV>(areaKey, key);
+	m_currentLevel.m_colliders.AddStaticCollider<BoxBV>(areaKey, key);
 
 	// Link to the scene node wall colliders
 	m_currentLevel.m_colliders.LinkToNode(m_currentLevel.m_scene, key, key);
@@ -309,13 +309,13 @@ PhysicsLib::Teleporter* Game::CreateTeleporters(const std::string& key, const Li
 	BVHierarchy&	colliders = m_currentLevel.m_colliders;
 
 	// Add the teleporter collider
-	PhysicsLib::Teleporter*	teleporter = colliders.AddCollider<PhysicsLib::Teleporter>(areaKey, std::string(key), pos, LibMath::Vector3(5.f, 5.f, 5.f), PhysicsLib::TELEPORTER);
+	PhysicsLib::Teleporter*	teleporter = colliders.AddStaticCollider<PhysicsLib::Teleporter>(areaKey, std::string(key), pos, LibMath::Vector3(5.f, 5.f, 5.f), PhysicsLib::TELEPORTER);
 
 	// Set the key of the teleporter
 	std::string	otherKey = key + " other";
 
 	// Add another collider
-	teleporter->m_otherSide = colliders.AddCollider<PhysicsLib::Teleporter>(areaKey, otherKey, otherPos, LibMath::Vector3(5.f, 5.f, 5.f), PhysicsLib::TELEPORTER);
+	teleporter->m_otherSide = colliders.AddStaticCollider<PhysicsLib::Teleporter>(areaKey, otherKey, otherPos, LibMath::Vector3(5.f, 5.f, 5.f), PhysicsLib::TELEPORTER);
 
 	teleporter->m_otherSide->m_otherSide = teleporter;
 
@@ -325,10 +325,10 @@ PhysicsLib::Teleporter* Game::CreateTeleporters(const std::string& key, const Li
 // Reset the level
 void Game::ResetLevel(void)
 {
-	// Destroy the current level
+	// Destroy the current level, its nodes, meshes & colliders go back to their pools
 	m_currentLevel.~Level();
 
-	// Create a new level
+	// Create a new level, reloading it reuses the freed slots instead of allocating
 	new (&m_currentLevel) Level();
 }
 
@@ -457,7 +457,7 @@ void Game::ReadBlock()
 	// Add a collider for the wall
 	m_sceneBuf >> type >> value2;
 
-	m_currentLevel.m_colliders.AddCollider<BoxBV>(value2, value1);
+	m_currentLevel.m_colliders.AddStaticCollider<BoxBV>(value2, value1);
 
 	// Link to the scene node wall colliders
 	m_currentLevel.m_colliders.LinkToNode(m_currentLevel.m_scene, value1, value1);
@@ -509,7 +509,7 @@ void Game::ReadHoledBlock()
 
 	// Create a specific collider for the wall with hole
 	PhysicsLib::HoledCollider* collider =
-	m_currentLevel.m_colliders.AddCollider<PhysicsLib::HoledCollider>
+	m_currentLevel.m_colliders.AddStaticCollider<PhysicsLib::HoledCollider>
 	(
 		value2, value1, position, scale, PhysicsLib::HOLED
 	);
@@ -521,7 +521,7 @@ void Game::ReadHoledBlock()
 
 
 	// Add a collider for the wall
-	collider->m_hole = m_currentLevel.m_colliders.AddCollider<BoxBV>
+	collider->m_hole = m_currentLevel.m_colliders.AddStaticCollider<BoxBV>
 	(
 		value2, holeKey, position, LibMath::Vector3{ 1.f, 1.f, 1.f }, PhysicsLib::IGNORE
 	);
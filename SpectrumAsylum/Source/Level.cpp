@@ -0,0 +1,151 @@
+#include "Level.h"
+
+namespace
+{
+	void HashCombine(uint64_t& hash, uint64_t value)
+	{
+		hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+	}
+
+	// Same depth first order for hashing, saving & loading
+	template<typename TNode, typename TFunc>
+	void VisitNodes(TNode* node, TFunc& func)
+	{
+		func(node);
+
+		for (auto* child : node->m_children)
+			VisitNodes(child, func);
+	}
+
+	template<typename TRoot, typename TFunc>
+	void VisitGraph(TRoot* root, TFunc func)
+	{
+		if (!root)
+			return;
+
+		for (auto* node : root->m_children)
+			VisitNodes(node, func);
+	}
+
+	// Every collider type but SPHERE is a box, see COLLIDER_TYPE
+	void SaveCollider(const PhysicsLib::ICollider* collider, SnapshotBuffer& buffer)
+	{
+		if (collider->m_type == PhysicsLib::SPHERE)
+		{
+			const PhysicsLib::SphereCollider* sphere = static_cast<const PhysicsLib::SphereCollider*>(collider);
+
+			buffer.Write(sphere->m_position);
+			buffer.Write(sphere->m_radius);
+			return;
+		}
+
+		const PhysicsLib::BoxCollider* box = static_cast<const PhysicsLib::BoxCollider*>(collider);
+
+		buffer.Write(box->m_position);
+		buffer.Write(box->m_boxScale);
+		buffer.Write(box->m_minVertex);
+		buffer.Write(box->m_maxVertex);
+		buffer.Write(box->m_enabled);
+	}
+
+	// Return false if the buffer ran out
+	bool LoadCollider(PhysicsLib::ICollider* collider, SnapshotBuffer& buffer)
+	{
+		if (collider->m_type == PhysicsLib::SPHERE)
+		{
+			PhysicsLib::SphereCollider* sphere = static_cast<PhysicsLib::SphereCollider*>(collider);
+
+			return buffer.Read(sphere->m_position) && buffer.Read(sphere->m_radius);
+		}
+
+		PhysicsLib::BoxCollider* box = static_cast<PhysicsLib::BoxCollider*>(collider);
+
+		return buffer.Read(box->m_position) && buffer.Read(box->m_boxScale) && buffer.Read(box->m_minVertex) &&
+			   buffer.Read(box->m_maxVertex) && buffer.Read(box->m_enabled);
+	}
+}
+
+void Level::CaptureSnapshot(void)
+{
+	m_snapshot.Clear();
+	m_snapshot.Write(LayoutHash());
+
+	// Scene nodes, local transform & visibility then the object's own state
+	VisitGraph(m_scene.m_worldRoot, [this](Node* node)
+	{
+		m_snapshot.Write(node->m_translation);
+		m_snapshot.Write(node->m_rotation);
+		m_snapshot.Write(node->m_scale);
+		m_snapshot.Write(node->m_render);
+
+		if (ISceneObject* object = static_cast<SceneNode*>(node)->m_object)
+			object->SaveState(m_snapshot);
+	});
+
+	VisitGraph(m_colliders.m_hierarchy.m_worldRoot, [this](BVHierarchy::BVNode* node)
+	{
+		if (node->m_collider)
+			SaveCollider(node->m_collider, m_snapshot);
+	});
+}
+
+bool Level::RestoreSnapshot(void)
+{
+	if (m_snapshot.Empty())
+		return false;
+
+	uint64_t layout = 0;
+
+	m_snapshot.Rewind();
+
+	if (!m_snapshot.Read(layout) || layout != LayoutHash())
+		return false;
+
+	// Any short read leaves the level half restored, the caller reloads it
+	bool read = true;
+
+	// Matrices are rebuilt from the restored components on the next graph update
+	VisitGraph(m_scene.m_worldRoot, [this, &read](Node* node)
+	{
+		read = read && m_snapshot.Read(node->m_translation) && m_snapshot.Read(node->m_rotation) &&
+			   m_snapshot.Read(node->m_scale) && m_snapshot.Read(node->m_render);
+
+		node->MarkDirty();
+
+		if (ISceneObject* object = static_cast<SceneNode*>(node)->m_object)
+			read = read && object->LoadState(m_snapshot);
+	});
+
+	VisitGraph(m_colliders.m_hierarchy.m_worldRoot, [this, &read](BVHierarchy::BVNode* node)
+	{
+		if (node->m_collider)
+			read = read && LoadCollider(node->m_collider, m_snapshot);
+	});
+
+	// Static colliders are only refit when baked
+	m_colliders.MarkStaticDirty();
+
+	// Data left over means the snapshot does not match the level either
+	return read && m_snapshot.AtEnd();
+}
+
+uint64_t Level::LayoutHash(void) const
+{
+	uint64_t hash = 0;
+
+	VisitGraph(m_scene.m_worldRoot, [&hash](Node* node)
+	{
+		ISceneObject* object = static_cast<SceneNode*>(node)->m_object;
+
+		HashCombine(hash, node->m_key.Value());
+		HashCombine(hash, object ? static_cast<uint64_t>(object->m_type) + 1 : 0);
+	});
+
+	VisitGraph(m_colliders.m_hierarchy.m_worldRoot, [&hash](BVHierarchy::BVNode* node)
+	{
+		HashCombine(hash, node->m_key.Value());
+		HashCombine(hash, node->m_collider ? static_cast<uint64_t>(node->m_collider->m_type) + 1 : 0);
+	});
+
+	return hash;
+}
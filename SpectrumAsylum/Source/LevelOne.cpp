@@ -96,12 +96,12 @@ void InitLevelOne(Game& game)
 	Player::InitPlayer(gameObjects);
 
 	// Create world bounding box to serve as a universal parent collider
-	BoxBV*		world = colliders.AddCollider<BoxBV>("world");
+	BoxBV*		world = colliders.AddStaticCollider<BoxBV>("world");
 
 	// Make it big enough to contain the entire scene
 	world->m_boxScale = { 200.f, 200.f, 200.f };
 
-	// Create bounding volumes for broad phase sweeping
+	// Create parent volumes to group colliders by area
 	InitColliders(colliders);
 
 	// Place objects into scene
@@ -133,47 +133,72 @@ void InitLevelOne(Game& game)
 
 	spot->SetCutoff(cos(LibMath::Degree(7.5f)), cos(LibMath::Degree(17.5f)));
 
+	// Sort scene objects by type once the scene is complete, per frame code goes through these arrays
+	game.m_currentLevel.m_components.Build(gameObjects);
+
+	// Global transforms of the meshes placed above, colliders are fit to them
+	gameObjects.UpdateGraph();
+
+	// Fit the broad phase around every collider placed above
+	colliders.BuildBroadphase();
+
+	// Keep the starting state, restarting restores it instead of loading the level again
+	game.m_currentLevel.CaptureSnapshot();
+
 	game.m_sceneFile.close();
 
 }
 
+void RestartLevelOne(Game& game)
+{
+	// Assets, sound & shaders stay loaded, only gameplay state goes back
+	if (game.m_currentLevel.RestoreSnapshot())
+		return;
+
+	// Level changed shape since it was loaded, load it from scratch
+	game.ResetLevel();
+	InitLevelOne(game);
+}
+
 void InitColliders(BVHierarchy& colliders)
 {
-	// Underground bounding box, no collisions withing this box will be tested if player is not inside it
-	colliders.AddCollider<BoxBV>("world", std::string("underground"), LibMath::Vector3{ 25.1362f, -5.f, -7.19665f }, LibMath::Vector3{ 100.f, 5.f, 100.f });
+	// Areas only group colliders in the hierarchy, the broad phase tree is built from the colliders themselves
+
+	// Underground bounding box
+	colliders.AddStaticCollider<BoxBV>("world", std::string("underground"), LibMath::Vector3{ 25.1362f, -5.f, -7.19665f }, LibMath::Vector3{ 100.f, 5.f, 100.f });
 
-	// Ground level, no collision testing within it if player is on top of the stairs or underground
-	colliders.AddCollider<BoxBV>("world", std::string("ground level"), LibMath::Vector3{ 0.f, 1.5f, 0.f }, LibMath::Vector3{ 100.f, 1.5f, 100.f });
+	// Ground level
+	colliders.AddStaticCollider<BoxBV>("world", std::string("ground level"), LibMath::Vector3{ 0.f, 1.5f, 0.f }, LibMath::Vector3{ 100.f, 1.5f, 100.f });
 
 	// Second level, top of the stairs
-	colliders.AddCollider<BoxBV>("world", std::string("second level"), LibMath::Vector3{ 0.f, 5.9f, 0.f }, LibMath::Vector3{ 100.f, 3.5f, 100.f });
+	colliders.AddStaticCollider<BoxBV>("world", std::string("second level"), LibMath::Vector3{ 0.f, 5.9f, 0.f }, LibMath::Vector3{ 100.f, 3.5f, 100.f });
 
 	// Starting area on ground level, positive x z coordinates
-	colliders.AddCollider<BoxBV>("ground level", std::string("start"), LibMath::Vector3{ 25.f, 1.5f, 25.f }, LibMath::Vector3{ 80.f, 1.5f, 80.f });
+	colliders.AddStaticCollider<BoxBV>("ground level", std::string("start"), LibMath::Vector3{ 25.f, 1.5f, 25.f }, LibMath::Vector3{ 80.f, 1.5f, 80.f });
 
 	// Area two on ground level, negative x and positive z
-	colliders.AddCollider<BoxBV>("ground level", std::string("area2"), LibMath::Vector3{ -25.f, -0.3f, 25.f }, LibMath::Vector3{ 50.f, 10.f, 60.f });
+	colliders.AddStaticCollider<BoxBV>("ground level", std::string("area2"), LibMath::Vector3{ -25.f, -0.3f, 25.f }, LibMath::Vector3{ 50.f, 10.f, 60.f });
 
 	// Area three on ground level, negative x and z
-	colliders.AddCollider<BoxBV>("ground level", std::string("area3"), LibMath::Vector3{ -25.f, -0.3f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
+	colliders.AddStaticCollider<BoxBV>("ground level", std::string("area3"), LibMath::Vector3{ -25.f, -0.3f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
 
 	// Area four on ground level, positve x and negative z
-	colliders.AddCollider<BoxBV>("ground level", std::string("area4"), LibMath::Vector3{ 25.f, -0.3f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
+	colliders.AddStaticCollider<BoxBV>("ground level", std::string("area4"), LibMath::Vector3{ 25.f, -0.3f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
 
-	// Area one on second level (top of the stairs), same rules as ground level start
-	colliders.AddCollider<BoxBV>("second level", std::string("areasec1"), LibMath::Vector3{ 25.f, 5.9f, 25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
+	// Area one on second level (top of the stairs)
+	colliders.AddStaticCollider<BoxBV>("second level", std::string("areasec1"), LibMath::Vector3{ 25.f, 5.9f, 25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
 
-	// Area two on second level (top of the stairs), same rules as ground level area 2
-	colliders.AddCollider<BoxBV>("second level", std::string("areasec2"), LibMath::Vector3{ -25.f, 5.9f, 25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
+	// Area two on second level (top of the stairs)
+	colliders.AddStaticCollider<BoxBV>("second level", std::string("areasec2"), LibMath::Vector3{ -25.f, 5.9f, 25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
 
-	// Area three on second level (top of the stairs), same rules as ground level area 3
-	colliders.AddCollider<BoxBV>("second level", std::string("areasec3"), LibMath::Vector3{ -25.f, 5.9f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
+	// Area three on second level (top of the stairs)
+	colliders.AddStaticCollider<BoxBV>("second level", std::string("areasec3"), LibMath::Vector3{ -25.f, 5.9f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
 
-	// Area four on second level (top of the stairs), same rules as ground level area 4
-	colliders.AddCollider<BoxBV>("second level", std::string("areasec4"), LibMath::Vector3{ 25.f, 5.9f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
+	// Area four on second level (top of the stairs)
+	colliders.AddStaticCollider<BoxBV>("second level", std::string("areasec4"), LibMath::Vector3{ 25.f, 5.9f, -25.f }, LibMath::Vector3{ 35.f, 10.f, 35.f });
 
 	// Final tower going from second level to deep underground, only contains objects within said tower in-game
-	colliders.AddCollider<BoxBV>("world", std::string("final tower"), LibMath::Vector3{ 9.f, 0.f, 23.f }, LibMath::Vector3{ 6.f, 20.f, 6.f }, PhysicsLib::FINAL_TOWER);
+	colliders.AddStaticCollider<BoxBV>("world", std::string("final tower"), LibMath::Vector3{ 9.f, 0.f, 23.f }, LibMath::Vector3{ 6.f, 20.f, 6.f }, PhysicsLib::FINAL_TOWER);
 }
 
 void InitLevelOneHierarchies(Game& game)
@@ -325,7 +350,7 @@ void UpdateLevelOne(Game& game)
 	gameObjects.UpdateGraph();
 
 	// Get camera from graph
-	Camera*		camera = GetObject<Camera>(gameObjects, "camera");
+	Camera*		camera = GetObject<Camera>(gameObjects, "camera"_key);
 
 	// Update camera view and projection matrices
 	camera->UpdateCamera(game.m_window);
@@ -334,7 +359,7 @@ void UpdateLevelOne(Game& game)
 	Frustum		view = camera->CameraFrustum(game.m_window.GetAspectRatio(), 0.1f, 100.0f);
 
 	// Get player from scene graph
-	Player*		player = GetObject<Player>(gameObjects, "player");
+	Player*		player = GetObject<Player>(gameObjects, "player"_key);
 
 	// Update collider hierarchy
 	colliders.Update(view);
@@ -343,7 +368,7 @@ void UpdateLevelOne(Game& game)
 	player->UpdatePlayer(game.m_window, static_cast<float>(game.m_timer.GetDeltaTime()), colliders);
 
 	// Get spot light from graph
-	SpotLight*	spot = GetObject<SpotLight>(gameObjects, "spot");
+	SpotLight*	spot = GetObject<SpotLight>(gameObjects, "spot"_key);
 
 	// Turn on spot light
 	spot->m_enabled = true;
@@ -367,8 +392,7 @@ void UpdateLevelOne(Game& game)
 	{
 		Game::m_gameOver = false;
 
-		game.ResetLevel();
-		InitLevelOne(game);
+		RestartLevelOne(game);
 		game.m_currentState = IN_GAME;
 	}
 
@@ -387,23 +411,24 @@ void DrawScene(Game& game)
 	ResourceManager& assets = game.m_currentLevel.m_assets;
 	Graph<SceneNode>& gameObjects = game.m_currentLevel.m_scene;
 
-	Shader* shader = assets.Get<Shader>("lighting shader");
-	Shader* shader2 = assets.Get<Shader>("phone shader");
-	Shader* shader3 = assets.Get<Shader>("phone shader2");
+	// Keys hashed at compile time, no string is built per frame
+	Shader* shader = assets.Get<Shader>("lighting shader"_key);
+	Shader* shader2 = assets.Get<Shader>("phone shader"_key);
+	Shader* shader3 = assets.Get<Shader>("phone shader2"_key);
 
-	Mesh* phone = GetObject<Mesh>(gameObjects, "phone");
-	Mesh* phone1 = GetObject<Mesh>(gameObjects, "phone1");
+	Mesh* phone = GetObject<Mesh>(gameObjects, "phone"_key);
+	Mesh* phone1 = GetObject<Mesh>(gameObjects, "phone1"_key);
 
-	Camera* camera = GetObject<Camera>(gameObjects, "camera");
+	Camera* camera = GetObject<Camera>(gameObjects, "camera"_key);
 
-	SpotLight* spot = GetObject<SpotLight>(gameObjects, "spot");
+	SpotLight* spot = GetObject<SpotLight>(gameObjects, "spot"_key);
 	spot->SetPosition(camera->m_position);
 
 	LibMath::Vector3 direction = camera->GetFrontVector();
 	spot->SetDirection(direction.m_x, direction.m_y, direction.m_z);
 
 	game.m_window.SetWindowColor({ 0.f, 0.f, 0.f, 1.f }, RENDER_MODE::FILL);
-	ParseScene(gameObjects, shader, camera, game.m_timer.GetDeltaTime());
+	ParseScene(game.m_currentLevel.m_components, shader, camera, game.m_timer.GetDeltaTime());
 
 
 	shader2->Use();
@@ -59,25 +59,25 @@ void PlaceLights(Game& game)
 
 
 	// Light volumes next to spawnpont
-	LightBox*		lightBox1 = colliders.AddCollider<LightBox>("start", std::string("lightBox1"));
-	LightBox*		lightBox2 = colliders.AddCollider<LightBox>("start", std::string("lightBox2"));
+	LightBox*		lightBox1 = colliders.AddStaticCollider<LightBox>("start", std::string("lightBox1"));
+	LightBox*		lightBox2 = colliders.AddStaticCollider<LightBox>("start", std::string("lightBox2"));
 
 	// Light volumes in the back (next to hole)
-	LightBox*		corridorBox1 = colliders.AddCollider<LightBox>("world", std::string("corridorBox1"));
-	LightBox*		boxRightToHole = colliders.AddCollider<LightBox>("area4", std::string("box right to hole"));
-	LightBox*		boxAboveHole = colliders.AddCollider<LightBox>("world", std::string("box above hole"));
+	LightBox*		corridorBox1 = colliders.AddStaticCollider<LightBox>("world", std::string("corridorBox1"));
+	LightBox*		boxRightToHole = colliders.AddStaticCollider<LightBox>("area4", std::string("box right to hole"));
+	LightBox*		boxAboveHole = colliders.AddStaticCollider<LightBox>("world", std::string("box above hole"));
 
 	// Underground light volume
-	LightBox*		undergroundBox = colliders.AddCollider<LightBox>("underground", std::string("level-1 box"));
+	LightBox*		undergroundBox = colliders.AddStaticCollider<LightBox>("underground", std::string("level-1 box"));
 
 	// Post-teleportation light volumes in the back
-	LightBox*		backroomsBox = colliders.AddCollider<LightBox>("ground level", std::string("backrooms box"));
-	LightBox*		bottomStairsBox = colliders.AddCollider<LightBox>("start", std::string("bottom stairs box"));
-	LightBox*		backCorridor = colliders.AddCollider<LightBox>("ground level", std::string("back corridor box"));
-	LightBox*		backBox = colliders.AddCollider<LightBox>("ground level", std::string("back level box"));
+	LightBox*		backroomsBox = colliders.AddStaticCollider<LightBox>("ground level", std::string("backrooms box"));
+	LightBox*		bottomStairsBox = colliders.AddStaticCollider<LightBox>("start", std::string("bottom stairs box"));
+	LightBox*		backCorridor = colliders.AddStaticCollider<LightBox>("ground level", std::string("back corridor box"));
+	LightBox*		backBox = colliders.AddStaticCollider<LightBox>("ground level", std::string("back level box"));
 
 	// Top of the stairs
-	LightBox* ceilingBox = colliders.AddCollider<LightBox>("second level", std::string("ceiling light box"));
+	LightBox* ceilingBox = colliders.AddStaticCollider<LightBox>("second level", std::string("ceiling light box"));
 
 
 	// Translate and scale light volumes
@@ -246,125 +246,125 @@ void PlaceColorCubes(Game& game)
 
 
 	// First cube light volume
-	LightBox*		redCubeBox = colliders.AddCollider<LightBox>("world", std::string("red cube1 light box"));
+	LightBox*		redCubeBox = colliders.AddStaticCollider<LightBox>("world", std::string("red cube1 light box"));
 
 	// Transform AABB and add lights to handle
 	redCubeBox->SetColliderTransform({ 40.f, 1.f, 35.f }, { 20.f, 2.5f, 55.f });
-	redCubeBox->AddLight(cubeSpawn->m_light);
+	redCubeBox->AddLight(cubeSpawn->m_light.Get());
 
 
 	// Light volume for the two cubes left to the hole
-	LightBox*		nextToTrap = colliders.AddCollider<LightBox>("world", std::string("next to trap"));
+	LightBox*		nextToTrap = colliders.AddStaticCollider<LightBox>("world", std::string("next to trap"));
 
 	// Transform AABB and add lights to handle
 	nextToTrap->SetColliderTransform({ 3.40729f, 2.f, 11.78987f }, { 35.f, 0.1f, 20.f });
-	nextToTrap->AddLight(cube1->m_light);
-	nextToTrap->AddLight(cube2->m_light);
+	nextToTrap->AddLight(cube1->m_light.Get());
+	nextToTrap->AddLight(cube2->m_light.Get());
 
 	// Light volume for room with two cubes right to hole
-	LightBox*		twoCubesRoom = colliders.AddCollider<LightBox>("world", std::string("two blue cubes box"));
+	LightBox*		twoCubesRoom = colliders.AddStaticCollider<LightBox>("world", std::string("two blue cubes box"));
 
 	// Transform AABB and add lights
 	twoCubesRoom->SetColliderTransform({ 11.7526f, 1.f, -5.2917f }, {30.f, 2.f, 50.f });
-	twoCubesRoom->AddLight(cube3->m_light);
-	twoCubesRoom->AddLight(cube4->m_light);
+	twoCubesRoom->AddLight(cube3->m_light.Get());
+	twoCubesRoom->AddLight(cube4->m_light.Get());
 
 	// Add light previously created in PlaceLights
 	twoCubesRoom->AddLight(GetObject<PointLight>(gameObjects, "cube room light"));
 
 
 	// Light volume for orange cube right after falling into hole
-	LightBox*		cubeLight2 = colliders.AddCollider<LightBox>("world", std::string("cubeLight2"));
+	LightBox*		cubeLight2 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight2"));
 
 	// Transform AABB and add lights
 	cubeLight2->SetColliderTransform({ -10.f, -2.f, 0.f }, { 15.f, 2.f, 15.f });
-	cubeLight2->AddLight(cube5->m_light);
+	cubeLight2->AddLight(cube5->m_light.Get());
 
 
 	// Light volum for underground blue cube
-	LightBox*		cubeLight3 = colliders.AddCollider<LightBox>("world", std::string("cubeLight3"));
+	LightBox*		cubeLight3 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight3"));
 
 	// Transform AABB and add light
 	cubeLight3->SetColliderTransform({ 15.f, -4.4f, 10.f }, { 35.f, 2.f, 35.f });
-	cubeLight3->AddLight(cube6->m_light);
+	cubeLight3->AddLight(cube6->m_light.Get());
 
 	// Light volume for underground green cube
-	LightBox*		cubeLight4 = colliders.AddCollider<LightBox>("world", std::string("cubeLight4"));
+	LightBox*		cubeLight4 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight4"));
 
 	// Transform AABB and add light
 	cubeLight4->SetColliderTransform({ 21.f, -4.2f, -7.f }, { 15.f, 2.f, 15.f });
-	cubeLight4->AddLight(cube7->m_light);
+	cubeLight4->AddLight(cube7->m_light.Get());
 
 	// Light volume for underground white cube
-	LightBox*		cubeLight5 = colliders.AddCollider<LightBox>("world", std::string("cubeLight5"));
+	LightBox*		cubeLight5 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight5"));
 
 	// Transform AABB ans add light
 	cubeLight5->SetColliderTransform({ 29.f, -4.2f, -7.f }, { 50.f, 2.f, 50.f });
-	cubeLight5->AddLight(cube8->m_light);
+	cubeLight5->AddLight(cube8->m_light.Get());
 
 
 	// Light volume containing all 3 final tower cubes
-	LightBox*		towerBox = colliders.AddCollider<LightBox>("world", std::string("towerBox"));
+	LightBox*		towerBox = colliders.AddStaticCollider<LightBox>("world", std::string("towerBox"));
 
 	// Transform AABB
 	towerBox->SetColliderTransform({ 5.f, 0.f, 25.f }, { 50.f, 50.f, 35.f });
 
 	// Add all 3 final tower cubes
-	towerBox->AddLight(cube9->m_light);
-	towerBox->AddLight(cube10->m_light);
-	towerBox->AddLight(cube11->m_light);
+	towerBox->AddLight(cube9->m_light.Get());
+	towerBox->AddLight(cube10->m_light.Get());
+	towerBox->AddLight(cube11->m_light.Get());
 
 
 	// Light volume for white cubes after teleportation
-	LightBox*		cubeLight9 = colliders.AddCollider<LightBox>("world", std::string("cubeLight9"));
-	LightBox*		cubeLight10 = colliders.AddCollider<LightBox>("world", std::string("cubeLight10"));
-	LightBox*		cubeLight11 = colliders.AddCollider<LightBox>("world", std::string("cubeLight11"));
+	LightBox*		cubeLight9 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight9"));
+	LightBox*		cubeLight10 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight10"));
+	LightBox*		cubeLight11 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight11"));
 
 	// Transform AABBs and add lights
 	cubeLight9->SetColliderTransform({ -30.f, 1.3f, 29.f }, { 25.f, 2.f, 30.f });
-	cubeLight9->AddLight(cube12->m_light);
+	cubeLight9->AddLight(cube12->m_light.Get());
 
 	cubeLight10->SetColliderTransform({ -16.5f, 1.f, 14.f }, { 25.f, 2.f, 30.f });
-	cubeLight10->AddLight(cube13->m_light);
+	cubeLight10->AddLight(cube13->m_light.Get());
 
 	cubeLight11->SetColliderTransform({ -34.f, 1.3f, 1.f }, { 15.f, 2.f, 15.f });
-	cubeLight11->AddLight(cube14->m_light);
+	cubeLight11->AddLight(cube14->m_light.Get());
 
 
 
 	// Light volume for red cube behind walls
-	LightBox*		cubeLight12 = colliders.AddCollider<LightBox>("world", std::string("cubeLight12"));
+	LightBox*		cubeLight12 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight12"));
 
 	// Transform AABB and add light
 	cubeLight12->SetColliderTransform({ -34.f, 1.3f, -5.f }, { 15.f, 2.f, 15.f });
-	cubeLight12->AddLight(cube15->m_light);
+	cubeLight12->AddLight(cube15->m_light.Get());
 
 	// Light volume for green cube behind wall
-	LightBox*		cubeLight13 = colliders.AddCollider<LightBox>("world", std::string("cubeLight13"));
+	LightBox*		cubeLight13 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight13"));
 
 	// Transform AABB and add light
 	cubeLight13->SetColliderTransform({ -36.2f, 1.3f, 40.f }, { 7.f, 2.f, 25.f });
-	cubeLight13->AddLight(cube16->m_light);
+	cubeLight13->AddLight(cube16->m_light.Get());
 
 
 	// Light volume for blue cube at the end of platforming challenge
-	LightBox*		cubeLight15 = colliders.AddCollider<LightBox>("world", std::string("cubeLight15"));
+	LightBox*		cubeLight15 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight15"));
 
 	// Transform AABB
 	cubeLight15->SetColliderTransform({ 15.f, 1.3f, 70.f }, { 35.f, 2.f, 35.f });
 
 	// Add blue cube light
-	cubeLight15->AddLight(cube17->m_light);
+	cubeLight15->AddLight(cube17->m_light.Get());
 
 	// Add lights in platforming challenge previously created in PlaceLights()
 	cubeLight15->AddLight(GetObject<PointLight>(gameObjects, "light14"));
 	cubeLight15->AddLight(GetObject<PointLight>(gameObjects, "light15"));
 
 	// Light volume for moving white cube at the end of platforming challenge
-	LightBox*		cubeLight16 = colliders.AddCollider<LightBox>("world", std::string("cubeLight16"));
+	LightBox*		cubeLight16 = colliders.AddStaticCollider<LightBox>("world", std::string("cubeLight16"));
 
 	// Transform AABB and add light
 	cubeLight16->SetColliderTransform({ -13.f, 1.3f, 82.5f }, { 60.f, 2.f, 50.f });
-	cubeLight16->AddLight(cube24->m_light);
+	cubeLight16->AddLight(cube24->m_light.Get());
 
 }
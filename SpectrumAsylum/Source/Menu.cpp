@@ -392,11 +392,8 @@ void Game::Menu::RestartButton(bool value, Game& game)
 		// Update cursor mode
 		glfwSetInputMode(game.m_window.m_windowPtr, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
-		// Reset current level
-		game.ResetLevel();
-
-		// Re-initialize level one
-		InitLevelOne(game);
+		// Put level one back in its starting state
+		RestartLevelOne(game);
 
 		// Set current state to game state
 		game.m_currentState = IN_GAME;
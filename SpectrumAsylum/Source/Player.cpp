@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "imgui/imgui.h"
 
 #include "PhysicsLib/CollisionDetection.h"
@@ -124,13 +126,13 @@ void Player::ProcessKeyboardInput(KeyInput const& keyboardInput, float const& de
 
 void Player::Teleport(Collider* const collider)
 {
-	// Cast ICollider to Teleporter colldier
-	PhysicsLib::Teleporter*		teleporter = dynamic_cast<PhysicsLib::Teleporter*>(collider);
-
-	// Stop if dynamic cast failed
-	if (!teleporter)
+	// Stop if collider is not a teleporter
+	if (collider->m_type != PhysicsLib::TELEPORTER)
 		return;
 
+	// Cast ICollider to Teleporter colldier
+	PhysicsLib::Teleporter*		teleporter = static_cast<PhysicsLib::Teleporter*>(collider);
+
 	// Only teleport player once
 	if (!m_isTeleported)
 	{
@@ -148,29 +150,41 @@ void Player::Teleport(Collider* const collider)
 
 void Player::Collide(BVHierarchy& colliders)
 {
-	std::vector<BVHierarchy::BVNode*>	prunedList;
+	// Member lists, cleared & refilled each frame without reallocating
+	std::vector<BVHierarchy::BVNode*>&	prunedList = m_prunedColliders;
 
-	BVHierarchy::BVNode*				world = colliders.m_hierarchy.GetNode("world");
-
-	world->PruneColliders(m_collider, prunedList, world);
+	colliders.QueryColliders(m_collider, prunedList);
 
 	BoxBV* colorToSwap = nullptr;
 	float shortestDistance = 0.0f;
 
+	// Ray from the player's eyes, only cast on click
+	if (Application::m_leftClick)
+	{
+		Ray		colorRay({ m_position.m_x, m_position.m_y + m_playerHeight, m_position.m_z }, m_camera->GetFrontVector());
+
+		colliders.QueryColliders(colorRay, m_rayColliders);
+
+		for (BVHierarchy::BVNode* collider : m_rayColliders)
+			CastRay(colorRay, collider->m_collider, colorToSwap, shortestDistance);
+	}
+
+	m_lastInsideVolumes.swap(m_insideVolumes);
+	m_insideVolumes.clear();
+
 	// Iterate through all colliders
 	for (BVHierarchy::BVNode* collider : prunedList)
 	{
-		CastRay(collider->m_collider, colorToSwap, shortestDistance);
-
 		// Sphere collider
 		if (collider->TestCollision(m_collider))
 		{
 
 			if (collider->m_collider->m_type == PhysicsLib::LIGHT_BOX)
 			{
-				LightBox* lightBox = dynamic_cast<LightBox*>(collider->m_collider);
+				LightBox* lightBox = static_cast<LightBox*>(collider->m_collider);
 
 				lightBox->EnableLights();
+				m_insideVolumes.emplace_back(collider);
 			}
 
 			// Check for collision with teleporter
@@ -181,6 +195,7 @@ void Player::Collide(BVHierarchy& colliders)
 			else if (collider->m_collider->m_type == PhysicsLib::FINAL_TOWER)
 			{
 				m_insideTower = true;
+				m_insideVolumes.emplace_back(collider);
 
 				if (Application::m_shiftPressed)
 				{
@@ -215,16 +230,20 @@ void Player::Collide(BVHierarchy& colliders)
 					Game::m_doorHit = true;
 			}
 		}
-		else if (collider->m_collider->m_type == PhysicsLib::LIGHT_BOX)
-		{
-			LightBox* lightBox = dynamic_cast<LightBox*>(collider->m_collider);
+	}
 
-			lightBox->DisableLights();
-		}
-		else if (collider->m_collider->m_type == PhysicsLib::FINAL_TOWER)
-		{
+	// Volumes left since last frame, the query does not return volumes away from the player
+	for (const Handle<BVHierarchy::BVNode>& volume : m_lastInsideVolumes)
+	{
+		BVHierarchy::BVNode* collider = volume.Get();
+
+		if (!collider || std::find(m_insideVolumes.begin(), m_insideVolumes.end(), volume) != m_insideVolumes.end())
+			continue;
+
+		if (collider->m_collider->m_type == PhysicsLib::LIGHT_BOX)
+			static_cast<LightBox*>(collider->m_collider)->DisableLights();
+		else
 			m_insideTower = false;
-		}
 	}
 
 	// Disable raycast
@@ -236,7 +255,7 @@ void Player::Collide(BVHierarchy& colliders)
 	// Check color can be swap with given cube
 	if (colorToSwap && colorToSwap->m_type == PhysicsLib::COLOR_CUBE)
 	{
-		ColBoxBV* coloredBox = dynamic_cast<ColBoxBV*>(colorToSwap);
+		ColBoxBV* coloredBox = static_cast<ColBoxBV*>(colorToSwap);
 
 		coloredBox->m_color->Swap(m_color);
 
@@ -268,17 +287,10 @@ void Player::UpdatePlayer(Application& window, float deltaTime, BVHierarchy& col
 }
 
 
-void Player::CastRay(Collider* collider, BoxBV*& outBox, float& outDistance)
+void Player::CastRay(const Ray& colorRay, Collider* collider, BoxBV*& outBox, float& outDistance)
 {
-	// Do not test intersections if left mouse button was not clicked
-	if (!Application::m_leftClick)
-		return;
-
-	// Create ray going from player position going along camera direction
-	Ray			colorRay({ m_position.m_x, m_position.m_y + m_playerHeight, m_position.m_z }, m_camera->GetFrontVector());
-
-	// Cast ICollider object into BoxCollider
-	BoxBV*		box = dynamic_cast<BoxBV*>(collider);
+	// Cast ICollider object into BoxCollider, every type but SPHERE is a box
+	BoxBV*		box = collider->m_type != PhysicsLib::SPHERE ? static_cast<BoxBV*>(collider) : nullptr;
 
 	// Intersection distance to be written into
 	float	distance;
@@ -291,7 +303,7 @@ void Player::CastRay(Collider* collider, BoxBV*& outBox, float& outDistance)
 	if (box->m_type == PhysicsLib::HOLED)
 	{
 		// Cast BoxCollider to Holedcollider (box with a hole)
-		PhysicsLib::HoledCollider*		holed = dynamic_cast<PhysicsLib::HoledCollider*>(box);
+		PhysicsLib::HoledCollider*		holed = static_cast<PhysicsLib::HoledCollider*>(box);
 
 		// Player-hole distance variable to be written into
 		float dHole;
@@ -322,6 +334,43 @@ void Player::CastRay(Collider* collider, BoxBV*& outBox, float& outDistance)
 	}
 }
 
+void Player::SaveState(SnapshotBuffer& buffer) const
+{
+	buffer.Write(m_position);
+	buffer.Write(m_velocity);
+	buffer.Write(m_lastYPosition);
+
+	buffer.Write(m_color.m_red);
+	buffer.Write(m_color.m_green);
+	buffer.Write(m_color.m_blue);
+	buffer.Write(m_color.m_alpha);
+
+	buffer.Write(m_isGrounded);
+	buffer.Write(m_isTeleported);
+	buffer.Write(m_insideTower);
+}
+
+bool Player::LoadState(SnapshotBuffer& buffer)
+{
+	bool read = buffer.Read(m_position) && buffer.Read(m_velocity) && buffer.Read(m_lastYPosition);
+
+	read = read && buffer.Read(m_color.m_red) && buffer.Read(m_color.m_green) &&
+		   buffer.Read(m_color.m_blue) && buffer.Read(m_color.m_alpha);
+
+	read = read && buffer.Read(m_isGrounded) && buffer.Read(m_isTeleported) && buffer.Read(m_insideTower);
+
+	if (!read)
+		return false;
+
+	// Collider is not in the collider hierarchy, follow the player
+	m_collider->m_position = m_position;
+
+	// Doors compare against the phone color
+	Door::m_playerColor = &m_color;
+
+	return true;
+}
+
 void Player::ApplyHorizontalVelocity(LibMath::Vector3 const& direction, float velocity, float const& deltaTime)
 {
 
@@ -5,16 +5,22 @@
 #include "DoorLogic.h"
 #include "Scene.h"
 
-void ParseScene(Graph<SceneNode>& gameObjects, Shader* shader, Camera* camera, const float deltaTime)
+void ParseScene(const SceneComponents& components, Shader* shader, Camera* camera, const float deltaTime)
 {
-	// Temporary vector to get meshes
-	std::vector<Mesh*>	sceneMeshes;
-	
 	// Use shader
 	shader->Use();
 
-	for (SceneNode*	node : gameObjects.m_worldRoot->m_children)
-		ProcessNode(node, shader, sceneMeshes, deltaTime);
+	// Set light uniforms
+	for (const SceneComponents::Entry& entry : components.Of(LIGHT))
+		SetLight(entry.m_object, shader);
+
+	// Update color blocks
+	for (const SceneComponents::Entry& entry : components.Of(COLOR_BLOCK))
+		UpdateColorBlock(entry.m_object, deltaTime);
+
+	// Update door collision
+	for (const SceneComponents::Entry& entry : components.Of(DOOR))
+		UpdateDoor(entry.m_object);
 
 	// Set uniforms
 	shader->SetUniform("viewPos", camera->m_position);
@@ -22,43 +28,12 @@ void ParseScene(Graph<SceneNode>& gameObjects, Shader* shader, Camera* camera, c
 	shader->SetUniform("activeDirectionals", DirectionalLight::m_active);
 	shader->SetUniform("activeSpots", SpotLight::m_active);
 
-	// Draw all meshes
-	for (Mesh* mesh : sceneMeshes)
-		DrawMesh(mesh, shader, camera->m_viewProjection);
-}
-
-void ProcessNode(SceneNode* node, Shader* shader, std::vector<Mesh*>& meshes, const float deltaTime)
-{
-	// Get node type
-	switch (node->m_object->m_type)
-	{
-	case MESH:
-		// Check if visible in level (for frustum culling)
-		if (node->m_render)
-			// Push data into temporary mesh vector
-			meshes.push_back(dynamic_cast<Mesh*>(node->m_object));
-		break;
-	case LIGHT:
-		// Set light uniforms
-		SetLight(node->m_object, shader);
-		break;
-	case COLOR_BLOCK:
-		// Update color blocks
-		UpdateColorBlock(node->m_object, deltaTime);
-		break;
-	case DOOR:
-		// Update door collision
-		UpdateDoor(node->m_object);
-		break;
-	default:
-		break;
-	}
-
-	for (Node*	child : node->m_children)
-		ProcessNode(dynamic_cast<SceneNode*>(child), shader, meshes, deltaTime);
+	// Draw meshes visible in level (for frustum culling)
+	for (const SceneComponents::Entry& entry : components.Of(MESH))
+		if (entry.m_node->m_render)
+			DrawMesh(static_cast<Mesh*>(entry.m_object), shader, camera->m_viewProjection);
 }
 
-
 void DrawMesh(Mesh* mesh, Shader* shader, const LibMath::Matrix4& viewProjection)
 {
 	// Check mesh contains a texture
@@ -71,26 +46,15 @@ void DrawMesh(Mesh* mesh, Shader* shader, const LibMath::Matrix4& viewProjection
 	else
 		shader->SetUniform("isTextured", 0);
 
-	// Calculate mvp & normal matrices
-	LibMath::Matrix4	mvp = mesh->m_sceneNode->m_globalTransform * viewProjection;
-	LibMath::Matrix4	normalMat4 = mesh->m_sceneNode->m_globalTransform.GetInverse();
-
-	normalMat4.Transpose(normalMat4);
-
-	// Convert matrix 4 to matrix 3 (remove translation)
-	float	normalMatArray[] =
-	{
-		normalMat4.m_matrix[0][0], normalMat4.m_matrix[0][1], normalMat4.m_matrix[0][2],
-		normalMat4.m_matrix[1][0], normalMat4.m_matrix[1][1], normalMat4.m_matrix[1][2],
-		normalMat4.m_matrix[2][0], normalMat4.m_matrix[2][1], normalMat4.m_matrix[2][2]
-	};
-
-	LibMath::Matrix3	normalMat3(normalMatArray);
+	// Calculate mvp matrix, normal matrix is cached by the scene node
+	LibMath::Matrix4	model = mesh->m_model ? mesh->m_model->DrawTransform(mesh->m_sceneNode->GetGlobalTransform())
+											  : mesh->m_sceneNode->GetGlobalTransform();
+	LibMath::Matrix4	mvp = model * viewProjection;
 
 	// Send data to shaders
-	shader->SetUniform("model", mesh->m_sceneNode->m_globalTransform);
+	shader->SetUniform("model", model);
 	shader->SetUniform("mvp", mvp);
-	shader->SetUniform("normalMat", normalMat3);
+	shader->SetUniform("normalMat", mesh->m_sceneNode->GetNormalMatrix());
 
 	// Display mesh in game
 	mesh->Draw(*shader);
@@ -99,7 +63,7 @@ void DrawMesh(Mesh* mesh, Shader* shader, const LibMath::Matrix4& viewProjection
 
 void SetLight(ISceneObject* object, Shader* shader)
 {
-	BaseLight*	light = dynamic_cast<BaseLight*>(object);
+	BaseLight*	light = static_cast<BaseLight*>(object);
 
 	// Check light is enabled & not null pointer
 	if (light && light->m_enabled)
@@ -111,8 +75,8 @@ void SetLight(ISceneObject* object, Shader* shader)
 void UpdateColorBlock(ISceneObject* object, const float deltaTime)
 {
 	// Get pointer to given color block & color block's mesh
-	ColorBlock*	colorBlock = dynamic_cast<ColorBlock*>(object);
-	Mesh*	mesh = colorBlock->m_mesh;
+	ColorBlock*	colorBlock = static_cast<ColorBlock*>(object);
+	Mesh*	mesh = colorBlock->m_mesh.Get();
 
 	// Update movement for relevant blocks
 	colorBlock->UpdateMovement(deltaTime);
@@ -132,9 +96,9 @@ void UpdateColorBlock(ISceneObject* object, const float deltaTime)
 		// Update position of color block mesh
 		LibMath::Vector3	meshPosition =
 		{
-			mesh->m_sceneNode->m_globalTransform.m_matrix[3][0],
-			mesh->m_sceneNode->m_globalTransform.m_matrix[3][1],
-			mesh->m_sceneNode->m_globalTransform.m_matrix[3][2]
+			mesh->m_sceneNode->GetGlobalTransform().m_matrix[3][0],
+			mesh->m_sceneNode->GetGlobalTransform().m_matrix[3][1],
+			mesh->m_sceneNode->GetGlobalTransform().m_matrix[3][2]
 		};
 
 		// Re-intialize point light with updated position & color
@@ -146,7 +110,7 @@ void UpdateColorBlock(ISceneObject* object, const float deltaTime)
 
 void UpdateDoor(ISceneObject* object)
 {
-	Door*	door = dynamic_cast<Door*>(object);
+	Door*	door = static_cast<Door*>(object);
 
 	// Check phone color is not null pointer
 	if (Door::m_playerColor)